@@ -53,4 +53,7 @@ CMAKE_DEPENDENT_OPTION(RANGE_V3_DOCS
   "Build the Range-v3 documentation"
   ON "${is_standalone}" OFF)
 
-mark_as_advanced(RANGE_V3_PERF)
+set(RANGE_V3_PERF_MAX_PENALTY "2.0" CACHE STRING
+  "How many times slower than a hand-written loop a range pipeline may be before the abstraction penalty benchmark fails")
+
+mark_as_advanced(RANGE_V3_PERF RANGE_V3_PERF_MAX_PENALTY)
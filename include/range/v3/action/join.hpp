@@ -25,6 +25,7 @@
 #include <range/v3/action/push_back.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -43,15 +44,35 @@ namespace ranges
 
         struct join_fn
         {
+        private:
+            // Joined containers give a container with the allocator of the
+            // first of them.
+            template<typename Cont, typename I, typename S>
+            static Cont make_(I const & it, S const & last, std::true_type)
+            {
+                return it == last ? Cont() : Cont((*it).get_allocator());
+            }
+            template<typename Cont, typename I, typename S>
+            static Cont make_(I const &, S const &, std::false_type)
+            {
+                return Cont();
+            }
+
+        public:
             template(typename Rng)(
                 /// \pre
                 requires input_range<Rng> AND input_range<range_value_t<Rng>> AND
                     semiregular<join_action_value_t_<Rng>>)
             join_action_value_t_<Rng> operator()(Rng && rng) const
             {
-                join_action_value_t_<Rng> ret;
+                using cont_t = join_action_value_t_<Rng>;
+                using use_allocator_t =
+                    meta::bool_<forward_range<Rng> && container<range_value_t<Rng>> &&
+                                detail::allocator_aware<cont_t>>;
                 auto last = ranges::end(rng);
-                for(auto it = begin(rng); it != last; ++it)
+                auto it = begin(rng);
+                auto ret = make_<cont_t>(it, last, use_allocator_t{});
+                for(; it != last; ++it)
                     push_back(ret, *it);
                 return ret;
             }
@@ -24,6 +24,7 @@
 #include <range/v3/action/insert.hpp>
 #include <range/v3/detail/with_braced_init_args.hpp>
 #include <range/v3/functional/bind_back.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -55,12 +56,59 @@ namespace ranges
             unwrap_reference(cont).push_back(static_cast<T &&>(t));
         }
 
+        /// \cond
+        // A range of unknown size with a size hint is appended in one pass,
+        // after growing the container once to fit it, when the hint is tight
+        // or the range is single-pass. A multi-pass range with a loose hint is
+        // inserted as before, which counts it first.
+        template<typename Cont, typename Rng>
+        using push_back_hinted = meta::bool_<
+            !sized_range<Rng> && detail::has_size_hint_v<Rng> && reservable<Cont> &&
+            meta::is_trait<meta::defer<push_back_t, Cont, range_reference_t<Rng>>>::value>;
+
+        template<typename Cont, typename Rng>
+        void push_back_range_(Cont && cont, Rng && rng, std::false_type)
+        {
+            ranges::insert(cont, end(cont), static_cast<Rng &&>(rng));
+        }
+        template<typename Cont, typename Rng>
+        void push_back_range_(Cont && cont_, Rng && rng, std::true_type)
+        {
+            if(RANGES_CONSTEXPR_IF(forward_range<Rng>))
+            {
+                if(!detail::size_hint_tight(ranges::size_hint(rng)))
+                    return adl_push_back_detail::push_back_range_(
+                        cont_, static_cast<Rng &&>(rng), std::false_type{});
+            }
+            auto & cont = unwrap_reference(cont_);
+            using size_type = decltype(cont.max_size());
+            auto const max_size = static_cast<std::size_t>(cont.max_size());
+            auto const old_size = static_cast<std::size_t>(ranges::size(cont));
+            auto const old_capacity = static_cast<std::size_t>(cont.capacity());
+            auto const delta = detail::size_hint_capacity(ranges::size_hint(rng));
+            auto const new_size =
+                delta < max_size - old_size ? old_size + delta : max_size;
+            if(old_capacity < new_size)
+                cont.reserve(static_cast<size_type>(
+                    old_capacity <= max_size / 3 * 2
+                        ? ranges::max(old_capacity + old_capacity / 2, new_size)
+                        : max_size));
+            for(auto first = ranges::begin(rng), last = ranges::end(rng);
+                first != last;
+                ++first)
+                cont.push_back(*first);
+        }
+        /// \endcond
+
         template(typename Cont, typename Rng)(
             /// \pre
             requires lvalue_container_like<Cont> AND range<Rng>)
         insert_t<Cont, Rng> push_back(Cont && cont, Rng && rng)
         {
-            ranges::insert(cont, end(cont), static_cast<Rng &&>(rng));
+            adl_push_back_detail::push_back_range_(
+                cont,
+                static_cast<Rng &&>(rng),
+                push_back_hinted<uncvref_t<unwrap_reference_t<Cont>>, Rng>{});
         }
 
         /// \cond
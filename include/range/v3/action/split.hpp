@@ -68,8 +68,8 @@ namespace ranges
             std::vector<split_value_t<Rng>> //
             operator()(Rng && rng, range_value_t<Rng> val) const
             {
-                return views::split(rng, std::move(val)) |
-                       to<std::vector<split_value_t<Rng>>>();
+                return detail::to_split_pieces<split_value_t<Rng>>(
+                    views::split(rng, std::move(val)), rng);
             }
 
             template(typename Rng, typename Pattern)(
@@ -84,8 +84,8 @@ namespace ranges
             std::vector<split_value_t<Rng>> operator()(Rng && rng, Pattern && pattern)
                 const
             {
-                return views::split(rng, static_cast<Pattern &&>(pattern)) |
-                       to<std::vector<split_value_t<Rng>>>();
+                return detail::to_split_pieces<split_value_t<Rng>>(
+                    views::split(rng, static_cast<Pattern &&>(pattern)), rng);
             }
 
             /// \cond
@@ -65,8 +65,8 @@ namespace ranges
                                                    std::pair<bool, iterator_t<Rng>>>)
             std::vector<split_value_t<Rng>> operator()(Rng && rng, Fun fun) const
             {
-                return views::split_when(rng, std::move(fun)) |
-                       to<std::vector<split_value_t<Rng>>>();
+                return detail::to_split_pieces<split_value_t<Rng>>(
+                    views::split_when(rng, std::move(fun)), rng);
             }
 
             template(typename Rng, typename Fun)(
@@ -76,8 +76,8 @@ namespace ranges
                             copy_constructible<Fun>)
             std::vector<split_value_t<Rng>> operator()(Rng && rng, Fun fun) const
             {
-                return views::split_when(rng, std::move(fun)) |
-                       to<std::vector<split_value_t<Rng>>>();
+                return detail::to_split_pieces<split_value_t<Rng>>(
+                    views::split_when(rng, std::move(fun)), rng);
             }
         };
 
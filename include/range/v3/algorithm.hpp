@@ -29,6 +29,7 @@
 #include <range/v3/algorithm/ends_with.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/equal_range_many.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/fill_n.hpp>
 #include <range/v3/algorithm/find.hpp>
@@ -37,6 +38,7 @@
 #include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_buffered.hpp>
 #include <range/v3/algorithm/for_each_n.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/algorithm/generate_n.hpp>
@@ -47,9 +49,11 @@
 #include <range/v3/algorithm/is_sorted_until.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
 #include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/lower_bound_many.hpp>
 #include <range/v3/algorithm/max.hpp>
 #include <range/v3/algorithm/max_element.hpp>
 #include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
 #include <range/v3/algorithm/min.hpp>
 #include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/algorithm/minmax.hpp>
@@ -65,6 +69,7 @@
 #include <range/v3/algorithm/partition_copy.hpp>
 #include <range/v3/algorithm/partition_point.hpp>
 #include <range/v3/algorithm/permutation.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
 #include <range/v3/algorithm/remove.hpp>
 #include <range/v3/algorithm/remove_copy.hpp>
 #include <range/v3/algorithm/remove_copy_if.hpp>
@@ -99,6 +104,7 @@
 #include <range/v3/algorithm/aux_/lower_bound_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
+#include <range/v3/algorithm/aux_/radix_sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/upper_bound_n.hpp>
 
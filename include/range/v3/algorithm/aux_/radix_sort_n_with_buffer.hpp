@@ -0,0 +1,317 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_RADIX_SORT_N_WITH_BUFFER_HPP
+#define RANGES_V3_ALGORITHM_AUX_RADIX_SORT_N_WITH_BUFFER_HPP
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+/// \def RANGES_SORT_USE_RADIX
+/// When non-zero, \c ranges::sort and \c ranges::stable_sort sort large inputs
+/// with an LSD radix sort if the comparator is \c less and the projected keys
+/// are arithmetic. This costs a temporary buffer as large as the input.
+#ifndef RANGES_SORT_USE_RADIX
+#define RANGES_SORT_USE_RADIX 0
+#endif
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Maps an arithmetic key onto an unsigned integer such that the
+        // unsigned order of the images is the order of the keys under less.
+        template<typename T, bool = std::is_integral<T>::value,
+                 bool = std::is_floating_point<T>::value>
+        struct radix_key
+        {};
+
+        template<typename T>
+        struct radix_key<T, true, false>
+        {
+            using type = meta::_t<std::make_unsigned<T>>;
+            static type get(T t) noexcept
+            {
+                return static_cast<type>(
+                    static_cast<type>(t) ^
+                    (std::is_signed<T>::value
+                         ? static_cast<type>(type(1) << (sizeof(type) * CHAR_BIT - 1))
+                         : type(0)));
+            }
+        };
+
+        template<>
+        struct radix_key<bool, true, false>
+        {
+            using type = unsigned char;
+            static type get(bool b) noexcept
+            {
+                return b ? type(1) : type(0);
+            }
+        };
+
+        template<typename T, typename U>
+        struct radix_float_key
+        {
+            using type = U;
+            static type get(T t) noexcept
+            {
+                constexpr U sign = U(1) << (sizeof(U) * CHAR_BIT - 1);
+                U u;
+                std::memcpy(&u, &t, sizeof(U));
+                // -0.0 and +0.0 compare equal; give them the same key.
+                if((u & ~sign) == 0)
+                    u = 0;
+                return (u & sign) ? U(~u) : U(u | sign);
+            }
+        };
+
+        template<typename T>
+        struct radix_key<T, false, true>
+          : meta::if_c<std::numeric_limits<T>::is_iec559 && sizeof(T) == 4,
+                       radix_float_key<T, std::uint32_t>,
+                       meta::if_c<std::numeric_limits<T>::is_iec559 && sizeof(T) == 8,
+                                  radix_float_key<T, std::uint64_t>, meta::nil_>>
+        {};
+
+        template<typename K>
+        using radix_key_image_t = typename radix_key<K>::type;
+
+        // The key an iterator's elements project to, provided it is the same
+        // whether the projection is applied to the iterator's reference type or
+        // to an lvalue of its value type (which is what the buffer holds).
+        template<typename I, typename P, typename = void>
+        struct radix_projected_key
+        {};
+
+        template<typename I, typename P>
+        struct radix_projected_key<
+            I, P,
+            detail::enable_if_t<RANGES_IS_SAME(
+                uncvref_t<indirect_result_t<P &, I>>,
+                uncvref_t<invoke_result_t<P &, iter_value_t<I> &>>)>>
+        {
+            using type = uncvref_t<indirect_result_t<P &, I>>;
+        };
+
+        template<typename I, typename P>
+        using radix_projected_key_t = meta::_t<radix_projected_key<I, P>>;
+
+        template<typename I, typename P, typename = void>
+        struct radix_sortable_ : std::false_type
+        {};
+
+        template<typename I, typename P>
+        struct radix_sortable_<
+            I, P, meta::void_<radix_key_image_t<radix_projected_key_t<I, P>>>>
+          : std::true_type
+        {};
+
+        template<typename I, typename P>
+        RANGES_INLINE_VAR constexpr bool radix_sortable_v = radix_sortable_<I, P>::value;
+
+        template<typename C, typename K>
+        RANGES_INLINE_VAR constexpr bool is_radix_less_v =
+            RANGES_IS_SAME(C, less) || RANGES_IS_SAME(C, std::less<>) ||
+            RANGES_IS_SAME(C, std::less<K>);
+
+        template<typename I, typename C, typename P, bool = radix_sortable_v<I, P>>
+        struct use_radix_sort : std::false_type
+        {};
+
+        template<typename I, typename C, typename P>
+        struct use_radix_sort<I, C, P, true>
+          : meta::bool_<(RANGES_SORT_USE_RADIX != 0) &&
+                        is_radix_less_v<C, radix_projected_key_t<I, P>>>
+        {};
+
+        constexpr std::ptrdiff_t radix_sort_threshold()
+        {
+            return 1 << 10;
+        }
+
+        constexpr int radix_sort_buckets()
+        {
+            return 1 << CHAR_BIT;
+        }
+
+        // Stable counting scatter of [first, last) into out on one byte of the
+        // key. count is the histogram of that byte.
+        template<typename K, typename I, typename O, typename P>
+        void radix_scatter(I first, I last, O out, std::size_t const * count,
+                           unsigned shift, P & proj)
+        {
+            using D = iter_difference_t<O>;
+            D offset[radix_sort_buckets()];
+            D sum = 0;
+            for(int b = 0; b < radix_sort_buckets(); ++b)
+            {
+                offset[b] = sum;
+                sum += static_cast<D>(count[b]);
+            }
+            for(; first != last; ++first)
+            {
+                auto const byte = static_cast<std::size_t>(
+                    (radix_key<K>::get(invoke(proj, *first)) >> shift) &
+                    static_cast<unsigned>(radix_sort_buckets() - 1));
+                out[offset[byte]++] = iter_move(first);
+            }
+        }
+
+        template<typename I, typename V, typename P>
+        void radix_sort_with_buffer(I first, iter_difference_t<I> n, V * buff,
+                                    P & proj)
+        {
+            using K = radix_projected_key_t<I, P>;
+            using U = radix_key_image_t<K>;
+            constexpr int passes = static_cast<int>(sizeof(U));
+            constexpr int buckets = radix_sort_buckets();
+            I last = first + n;
+
+            // One pass over the data computes the histograms of every byte.
+            std::size_t count[passes][buckets] = {};
+            for(I it = first; it != last; ++it)
+            {
+                U const u = radix_key<K>::get(invoke(proj, *it));
+                for(int p = 0; p < passes; ++p)
+                    ++count[p][(u >> (p * CHAR_BIT)) & unsigned(buckets - 1)];
+            }
+
+            // A byte on which all the keys agree needs no pass.
+            int active[passes];
+            int nactive = 0;
+            for(int p = 0; p < passes; ++p)
+            {
+                U const u = radix_key<K>::get(invoke(proj, *first));
+                auto const byte = (u >> (p * CHAR_BIT)) & unsigned(buckets - 1);
+                if(count[p][byte] != static_cast<std::size_t>(n))
+                    active[nactive++] = p;
+            }
+            if(nactive == 0)
+                return;
+
+            V * const buff_end = buff + n;
+            auto tmpbuf = make_raw_buffer(buff);
+            bool in_buffer = false;
+            if(!detail::is_trivially_copyable_v<V>)
+            {
+                // The buffer must hold live objects before we can assign into it
+                // out of order, so move everything over first.
+                ranges::move(first, last, tmpbuf.begin());
+                in_buffer = true;
+            }
+            for(int i = 0; i < nactive; ++i, in_buffer = !in_buffer)
+            {
+                unsigned const shift = static_cast<unsigned>(active[i] * CHAR_BIT);
+                if(in_buffer)
+                    detail::radix_scatter<K>(
+                        buff, buff_end, first, count[active[i]], shift, proj);
+                else
+                    detail::radix_scatter<K>(
+                        first, last, buff, count[active[i]], shift, proj);
+            }
+            if(in_buffer)
+            {
+                I out = first;
+                for(V * p = buff; p != buff_end; ++p, ++out)
+                    *out = std::move(*p);
+            }
+        }
+
+        // Sort [first, first + n) with a radix sort if use_radix_sort says so
+        // and a large enough buffer is to hand. Returns whether it did.
+        template<typename I, typename V, typename C, typename P>
+        bool try_radix_sort_(I first, iter_difference_t<I> n, V * buff,
+                             std::ptrdiff_t buff_size, C &, P & proj, std::true_type)
+        {
+            if(n < detail::radix_sort_threshold())
+                return false;
+            std::unique_ptr<V, detail::return_temporary_buffer> h;
+            if(buff == nullptr)
+            {
+                auto buf = detail::get_temporary_buffer<V>(n);
+                h.reset(buf.first);
+                buff = buf.first;
+                buff_size = buf.second;
+            }
+            if(buff_size < n)
+                return false;
+            detail::radix_sort_with_buffer(first, n, buff, proj);
+            return true;
+        }
+
+        template<typename I, typename V, typename C, typename P>
+        bool try_radix_sort_(I, iter_difference_t<I>, V *, std::ptrdiff_t, C &, P &,
+                             std::false_type)
+        {
+            return false;
+        }
+
+        template<typename I, typename C, typename P>
+        bool try_radix_sort(I first, iter_difference_t<I> n,
+                            iter_value_t<I> * buff, std::ptrdiff_t buff_size,
+                            C & pred, P & proj)
+        {
+            return detail::try_radix_sort_(
+                first, n, buff, buff_size, pred, proj, use_radix_sort<I, C, P>{});
+        }
+    } // namespace detail
+    /// \endcond
+
+    namespace aux
+    {
+        struct radix_sort_n_with_buffer_fn
+        {
+            /// Stable LSD radix sort of the \c n elements starting at \c first by
+            /// the arithmetic key \c proj projects them to, in the order of \c
+            /// less. \c buff points to raw storage for at least \c n values.
+            template(typename I, typename V, typename P = identity)(
+                /// \pre
+                requires random_access_iterator<I> AND sortable<I, less, P> AND
+                    same_as<V, iter_value_t<I>> AND
+                    (detail::radix_sortable_v<I, P>))
+            I operator()(I first, iter_difference_t<I> n, V * buff, P proj = P{}) const
+            {
+                if(n > 1)
+                    detail::radix_sort_with_buffer(first, n, buff, proj);
+                return first + n;
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(radix_sort_n_with_buffer_fn, radix_sort_n_with_buffer)
+    } // namespace aux
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -28,6 +28,9 @@
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/trivial_copy.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -37,6 +40,60 @@ namespace ranges
     template<typename I, typename O>
     using copy_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O>
+        constexpr copy_result<I, O> copy_(I first, S last, O out, std::false_type)
+        {
+            for(; first != last; ++first, ++out)
+                *out = *first;
+            return {first, out};
+        }
+
+        template<typename I, typename S, typename O>
+        constexpr copy_result<I, O> copy_(I first, S last, O out, std::true_type)
+        {
+            if(!RANGES_IS_CONSTANT_EVALUATED())
+            {
+                auto const n = last - first;
+                out = detail::memmove_n(first, n, out);
+                return {first + n, out};
+            }
+            return detail::copy_(
+                std::move(first), std::move(last), std::move(out), std::false_type{});
+        }
+
+        template<typename Rng, typename O>
+        constexpr copy_result<iterator_t<Rng>, O> copy_range_(Rng & rng, O out,
+                                                              std::false_type)
+        {
+            return detail::copy_(
+                begin(rng),
+                end(rng),
+                std::move(out),
+                detail::is_memmovable<iterator_t<Rng>, sentinel_t<Rng>, O>{});
+        }
+
+        template<typename Rng, typename O>
+        copy_result<iterator_t<Rng>, O> copy_range_(Rng & rng, O out, std::true_type)
+        {
+            auto visit = [&](auto first, auto last) {
+                using I = decltype(first);
+                using S = decltype(last);
+                auto res = detail::copy_(std::move(first),
+                                         std::move(last),
+                                         std::move(out),
+                                         detail::is_memmovable<I, S, O>{});
+                out = std::move(res.out);
+                return std::move(res.in);
+            };
+            auto it = range_access::for_each_segment(rng, visit);
+            return {std::move(it), std::move(out)};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_HIDDEN_DETAIL(namespace _copy CPP_PP_LBRACE())
     RANGES_FUNC_BEGIN(copy)
 
@@ -47,9 +104,10 @@ namespace ranges
             weakly_incrementable<O> AND indirectly_copyable<I, O>)
         constexpr copy_result<I, O> RANGES_FUNC(copy)(I first, S last, O out) //
         {
-            for(; first != last; ++first, ++out)
-                *out = *first;
-            return {first, out};
+            return detail::copy_(std::move(first),
+                                 std::move(last),
+                                 std::move(out),
+                                 detail::is_memmovable<I, S, O>{});
         }
 
         /// \overload
@@ -60,7 +118,8 @@ namespace ranges
         constexpr copy_result<borrowed_iterator_t<Rng>, O> //
         RANGES_FUNC(copy)(Rng && rng, O out)  //
         {
-            return (*this)(begin(rng), end(rng), std::move(out));
+            return detail::copy_range_(
+                rng, std::move(out), meta::bool_<detail::segmented_range_v<Rng>>{});
         }
 
     RANGES_FUNC_END(copy)
@@ -27,6 +27,8 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/trivial_copy.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -36,6 +38,30 @@ namespace ranges
     template<typename I, typename O>
     using copy_backward_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O>
+        copy_backward_result<I, O> copy_backward_(I first, S end_, O out,
+                                                  std::false_type)
+        {
+            I i = ranges::next(first, end_), last = i;
+            while(first != i)
+                *--out = *--i;
+            return {last, out};
+        }
+
+        template<typename I, typename S, typename O>
+        copy_backward_result<I, O> copy_backward_(I first, S end_, O out,
+                                                  std::true_type)
+        {
+            auto const n = end_ - first;
+            out = detail::memmove_backward_n(first, n, out);
+            return {first + n, out};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(copy_backward)
 
         /// \brief function template \c copy_backward
@@ -45,10 +71,10 @@ namespace ranges
             bidirectional_iterator<O> AND indirectly_copyable<I, O>)
         copy_backward_result<I, O> RANGES_FUNC(copy_backward)(I first, S end_, O out)
         {
-            I i = ranges::next(first, end_), last = i;
-            while(first != i)
-                *--out = *--i;
-            return {last, out};
+            return detail::copy_backward_(std::move(first),
+                                          std::move(end_),
+                                          std::move(out),
+                                          detail::is_memmovable<I, S, O>{});
         }
 
         /// \overload
@@ -26,10 +26,91 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/simd.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename V, typename P>
+        iter_difference_t<I> count_(I first, S last, V const & val, P & proj,
+                                    std::false_type)
+        {
+            iter_difference_t<I> n = 0;
+            for(; first != last; ++first)
+                if(invoke(proj, *first) == val)
+                    ++n;
+            return n;
+        }
+
+        template<typename I, typename S, typename V, typename P>
+        iter_difference_t<I> count_(I first, S last, V const & val, P &, std::true_type)
+        {
+            auto const n = last - first;
+            iter_value_t<I> v{};
+            if(n == 0 || !detail::simd_value(val, v))
+                return 0;
+            return static_cast<iter_difference_t<I>>(detail::simd_count(
+                detail::simd_data(first), static_cast<std::size_t>(n), v));
+        }
+
+        template<typename Rng, typename V, typename P>
+        iter_difference_t<iterator_t<Rng>> count_range_(Rng & rng, V const & val,
+                                                        P & proj, std::false_type)
+        {
+            return detail::count_(
+                begin(rng),
+                end(rng),
+                val,
+                proj,
+                detail::is_simd_findable<iterator_t<Rng>, sentinel_t<Rng>, V, P>{});
+        }
+
+        // Count the matches in one segment, and return the end of the segment.
+        template<typename I, typename S, typename V, typename P, typename D>
+        I count_segment_(I first, S last, V const & val, P & proj, D & n,
+                         std::false_type)
+        {
+            for(; first != last; ++first)
+                if(invoke(proj, *first) == val)
+                    ++n;
+            return first;
+        }
+
+        template<typename I, typename S, typename V, typename P, typename D>
+        I count_segment_(I first, S last, V const & val, P & proj, D & n,
+                         std::true_type)
+        {
+            auto const m = last - first;
+            n += static_cast<D>(detail::count_(first, last, val, proj, std::true_type{}));
+            return first + m;
+        }
+
+        template<typename Rng, typename V, typename P>
+        iter_difference_t<iterator_t<Rng>> count_range_(Rng & rng, V const & val,
+                                                        P & proj, std::true_type)
+        {
+            iter_difference_t<iterator_t<Rng>> n = 0;
+            auto visit = [&](auto first, auto last) {
+                using I = decltype(first);
+                using S = decltype(last);
+                return detail::count_segment_(std::move(first),
+                                              std::move(last),
+                                              val,
+                                              proj,
+                                              n,
+                                              detail::is_simd_findable<I, S, V, P>{});
+            };
+            range_access::for_each_segment(rng, visit);
+            return n;
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(count)
@@ -42,11 +123,11 @@ namespace ranges
         iter_difference_t<I> //
         RANGES_FUNC(count)(I first, S last, V const & val, P proj = P{})
         {
-            iter_difference_t<I> n = 0;
-            for(; first != last; ++first)
-                if(invoke(proj, *first) == val)
-                    ++n;
-            return n;
+            return detail::count_(std::move(first),
+                                  std::move(last),
+                                  val,
+                                  proj,
+                                  detail::is_simd_findable<I, S, V, P>{});
         }
 
         /// \overload
@@ -57,7 +138,8 @@ namespace ranges
         iter_difference_t<iterator_t<Rng>> //
         RANGES_FUNC(count)(Rng && rng, V const & val, P proj = P{})
         {
-            return (*this)(begin(rng), end(rng), val, std::move(proj));
+            return detail::count_range_(
+                rng, val, proj, meta::bool_<detail::segmented_range_v<Rng>>{});
         }
 
     RANGES_FUNC_END(count)
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_EQUAL_HPP
 #define RANGES_V3_ALGORITHM_EQUAL_HPP
 
+#include <cstring>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -28,6 +29,8 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -40,14 +43,57 @@ namespace ranges
     {
         template<typename I0, typename S0, typename I1, typename S1, typename C,
                  typename P0, typename P1>
-        constexpr bool equal_nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred,
-                                     P0 proj0, P1 proj1)
+        constexpr bool equal_nocheck_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::false_type)
         {
             for(; begin0 != end0 && begin1 != end1; ++begin0, ++begin1)
                 if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
                     return false;
             return begin0 == end0 && begin1 == end1;
         }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        constexpr bool equal_nocheck_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::true_type)
+        {
+            if(!RANGES_IS_CONSTANT_EVALUATED())
+            {
+                auto const n = end0 - begin0;
+                if(n != end1 - begin1)
+                    return false;
+                return n == 0 ||
+                       std::memcmp(detail::simd_data(begin0),
+                                   detail::simd_data(begin1),
+                                   static_cast<std::size_t>(n) *
+                                       sizeof(iter_value_t<I0>)) == 0;
+            }
+            return detail::equal_nocheck_(std::move(begin0),
+                                          std::move(end0),
+                                          std::move(begin1),
+                                          std::move(end1),
+                                          pred,
+                                          proj0,
+                                          proj1,
+                                          std::false_type{});
+        }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        constexpr bool equal_nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred,
+                                     P0 proj0, P1 proj1)
+        {
+            return detail::equal_nocheck_(
+                std::move(begin0),
+                std::move(end0),
+                std::move(begin1),
+                std::move(end1),
+                pred,
+                proj0,
+                proj1,
+                meta::bool_<is_simd_comparable<I0, S0, I1, S1, C, P0, P1>::value &&
+                            RANGES_IS_SAME(C, ranges::equal_to)>{});
+        }
     } // namespace detail
     /// \endcond
 
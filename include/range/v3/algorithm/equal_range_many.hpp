@@ -0,0 +1,131 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_EQUAL_RANGE_MANY_HPP
+#define RANGES_V3_ALGORITHM_EQUAL_RANGE_MANY_HPP
+
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/subrange.hpp>
+
+#include <range/v3/detail/gallop.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Whether an element is not greater than a value, to gallop to an
+        // upper bound.
+        template<typename C>
+        struct upper_bound_gallop_pred_
+        {
+            C & pred;
+
+            template<typename T, typename U>
+            bool operator()(T && t, U && u) const
+            {
+                return !invoke(pred, static_cast<U &&>(u), static_cast<T &&>(t));
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-algorithms
+    /// @{
+    template<typename I, typename O>
+    using equal_range_many_result = detail::in_out_result<I, O>;
+
+    RANGES_FUNC_BEGIN(equal_range_many)
+
+        /// \brief function template \c equal_range_many
+        ///
+        /// Writes to \c out the \c subrange of elements of <tt>[first, last)</tt>
+        /// equivalent to each needle in <tt>[nfirst, nlast)</tt>, which must be
+        /// sorted. Both ends of each subrange are galloped to from the lower
+        /// bound of the needle before, as in \c lower_bound_many.
+        template(typename I,
+                 typename S,
+                 typename I2,
+                 typename S2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_iterator<I> AND sentinel_for<S, I> AND
+                input_iterator<I2> AND sentinel_for<S2, I2> AND
+                output_iterator<O, subrange<I>> AND
+                indirect_strict_weak_order<C, I2, projected<I, P>>)
+        equal_range_many_result<I2, O> RANGES_FUNC(equal_range_many)(I first,
+                                                                     S last,
+                                                                     I2 nfirst,
+                                                                     S2 nlast,
+                                                                     O out,
+                                                                     C pred = C{},
+                                                                     P proj = P{})
+        {
+            detail::upper_bound_gallop_pred_<C> upper{pred};
+            for(; nfirst != nlast; ++nfirst, ++out)
+            {
+                auto && val = *nfirst;
+                first = detail::gallop(std::move(first), last, val, pred, proj);
+                I hi = detail::gallop(first, last, val, upper, proj);
+                *out = subrange<I>{first, std::move(hi)};
+            }
+            return {nfirst, out};
+        }
+
+        /// \overload
+        template(typename Rng,
+                 typename Rng2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_range<Rng> AND borrowed_range<Rng> AND
+                input_range<Rng2> AND output_iterator<O, subrange<iterator_t<Rng>>> AND
+                indirect_strict_weak_order<C, iterator_t<Rng2>, projected<iterator_t<Rng>, P>>)
+        equal_range_many_result<borrowed_iterator_t<Rng2>, O> //
+        RANGES_FUNC(equal_range_many)(
+            Rng && rng, Rng2 && needles, O out, C pred = C{}, P proj = P{})
+        {
+            return (*this)(begin(rng),
+                           end(rng),
+                           begin(needles),
+                           end(needles),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+    RANGES_FUNC_END(equal_range_many)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -22,10 +22,56 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/trivial_copy.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        template<typename O, typename S, typename V>
+        O fill_(O first, S last, V const & val, std::false_type)
+        {
+            for(; first != last; ++first)
+                *first = val;
+            return first;
+        }
+
+        template<typename O, typename S, typename V>
+        O fill_(O first, S last, V const & val, std::true_type)
+        {
+            return detail::memset_n(first, last - first, val);
+        }
+
+        template<typename Rng, typename V>
+        iterator_t<Rng> fill_range_(Rng & rng, V const & val, std::false_type)
+        {
+            return detail::fill_(
+                begin(rng),
+                end(rng),
+                val,
+                detail::is_memsettable<iterator_t<Rng>, sentinel_t<Rng>, V>{});
+        }
+
+        template<typename Rng, typename V>
+        iterator_t<Rng> fill_range_(Rng & rng, V const & val, std::true_type)
+        {
+            auto visit = [&](auto first, auto last) {
+                using O = decltype(first);
+                using S = decltype(last);
+                return detail::fill_(std::move(first),
+                                     std::move(last),
+                                     val,
+                                     detail::is_memsettable<O, S, V>{});
+            };
+            return range_access::for_each_segment(rng, visit);
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(fill)
@@ -36,9 +82,10 @@ namespace ranges
             requires output_iterator<O, V const &> AND sentinel_for<S, O>)
         O RANGES_FUNC(fill)(O first, S last, V const & val) //
         {
-            for(; first != last; ++first)
-                *first = val;
-            return first;
+            return detail::fill_(std::move(first),
+                                 std::move(last),
+                                 val,
+                                 detail::is_memsettable<O, S, V>{});
         }
 
         /// \overload
@@ -47,7 +94,8 @@ namespace ranges
             requires output_range<Rng, V const &>)
         borrowed_iterator_t<Rng> RANGES_FUNC(fill)(Rng && rng, V const & val)
         {
-            return (*this)(begin(rng), end(rng), val);
+            return detail::fill_range_(
+                rng, val, meta::bool_<detail::segmented_range_v<Rng>>{});
         }
 
     RANGES_FUNC_END(fill)
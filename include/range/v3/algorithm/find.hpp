@@ -27,10 +27,70 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+#include <range/v3/detail/simd.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename V, typename P>
+        constexpr I find_(I first, S last, V const & val, P & proj, std::false_type)
+        {
+            for(; first != last; ++first)
+                if(invoke(proj, *first) == val)
+                    break;
+            return first;
+        }
+
+        template<typename I, typename S, typename V, typename P>
+        constexpr I find_(I first, S last, V const & val, P & proj, std::true_type)
+        {
+            if(!RANGES_IS_CONSTANT_EVALUATED())
+            {
+                auto const n = last - first;
+                iter_value_t<I> v{};
+                if(n == 0 || !detail::simd_value(val, v))
+                    return first + n;
+                return first + static_cast<iter_difference_t<I>>(detail::simd_find(
+                                   detail::simd_data(first), static_cast<std::size_t>(n), v));
+            }
+            return detail::find_(
+                std::move(first), std::move(last), val, proj, std::false_type{});
+        }
+
+        template<typename Rng, typename V, typename P>
+        constexpr iterator_t<Rng> find_range_(Rng & rng, V const & val, P & proj,
+                                              std::false_type)
+        {
+            return detail::find_(
+                begin(rng),
+                end(rng),
+                val,
+                proj,
+                detail::is_simd_findable<iterator_t<Rng>, sentinel_t<Rng>, V, P>{});
+        }
+
+        template<typename Rng, typename V, typename P>
+        iterator_t<Rng> find_range_(Rng & rng, V const & val, P & proj, std::true_type)
+        {
+            auto visit = [&](auto first, auto last) {
+                using I = decltype(first);
+                using S = decltype(last);
+                return detail::find_(std::move(first),
+                                     std::move(last),
+                                     val,
+                                     proj,
+                                     detail::is_simd_findable<I, S, V, P>{});
+            };
+            return range_access::for_each_segment(rng, visit);
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(find)
@@ -49,10 +109,11 @@ namespace ranges
             indirect_relation<equal_to, projected<I, P>, V const *>)
         constexpr I RANGES_FUNC(find)(I first, S last, V const & val, P proj = P{})
         {
-            for(; first != last; ++first)
-                if(invoke(proj, *first) == val)
-                    break;
-            return first;
+            return detail::find_(std::move(first),
+                                 std::move(last),
+                                 val,
+                                 proj,
+                                 detail::is_simd_findable<I, S, V, P>{});
         }
 
         /// \overload
@@ -63,7 +124,8 @@ namespace ranges
         constexpr borrowed_iterator_t<Rng> //
         RANGES_FUNC(find)(Rng && rng, V const & val, P proj = P{})
         {
-            return (*this)(begin(rng), end(rng), val, std::move(proj));
+            return detail::find_range_(
+                rng, val, proj, meta::bool_<detail::segmented_range_v<Rng>>{});
         }
 
     RANGES_FUNC_END(find)
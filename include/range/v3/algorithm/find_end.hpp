@@ -22,8 +22,10 @@
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/searcher.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/reverse_iterator.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
@@ -144,9 +146,8 @@ namespace ranges
         }
 
         template<typename I1, typename I2, typename R, typename P>
-        subrange<I1> find_end_impl(I1 begin1, I1 end1, I2 begin2, I2 end2, R pred, P proj,
-                                   std::random_access_iterator_tag,
-                                   std::random_access_iterator_tag)
+        subrange<I1> find_end_ra_(I1 begin1, I1 end1, I2 begin2, I2 end2, R pred, P proj,
+                                  std::false_type)
         {
             // Take advantage of knowing source and pattern lengths.  Stop short when
             // source is smaller than pattern
@@ -176,6 +177,48 @@ namespace ranges
                 while(invoke(pred, invoke(proj, *--m1), *--m2));
             }
         }
+
+        // Long patterns are searched for from the back with a searcher over
+        // reversed ranges.
+        template<typename I1, typename I2, typename R, typename P>
+        subrange<I1> find_end_ra_(I1 begin1, I1 end1, I2 begin2, I2 end2, R pred, P proj,
+                                  std::true_type)
+        {
+            auto const len1 = end1 - begin1;
+            auto const len2 = end2 - begin2;
+            if(len2 < searcher_threshold || len1 < len2)
+                return detail::find_end_ra_(std::move(begin1),
+                                            std::move(end1),
+                                            std::move(begin2),
+                                            std::move(end2),
+                                            std::move(pred),
+                                            std::move(proj),
+                                            std::false_type{});
+            identity pattern_proj;
+            auto const res = detail::searcher_search(make_reverse_iterator(end1),
+                                                     len1,
+                                                     make_reverse_iterator(end2),
+                                                     len2,
+                                                     proj,
+                                                     pattern_proj);
+            if(res.empty())
+                return {end1, end1};
+            return {res.end().base(), res.begin().base()};
+        }
+
+        template<typename I1, typename I2, typename R, typename P>
+        subrange<I1> find_end_impl(I1 begin1, I1 end1, I2 begin2, I2 end2, R pred, P proj,
+                                   std::random_access_iterator_tag,
+                                   std::random_access_iterator_tag)
+        {
+            return detail::find_end_ra_(std::move(begin1),
+                                        std::move(end1),
+                                        std::move(begin2),
+                                        std::move(end2),
+                                        std::move(pred),
+                                        std::move(proj),
+                                        prefer_searcher<I1, I2, R, P, identity>{});
+        }
     } // namespace detail
     /// \endcond
 
@@ -21,13 +21,19 @@
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/functional/reference_wrapper.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/chunked.hpp>
+#include <range/v3/detail/segmented.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -37,6 +43,50 @@ namespace ranges
     template<typename I, typename F>
     using for_each_result = detail::in_fun_result<I, F>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename Rng, typename F, typename P>
+        iterator_t<Rng> for_each_segments_(Rng & rng, F & fun, P & proj, std::false_type)
+        {
+            auto first = begin(rng);
+            auto const last = end(rng);
+            for(; first != last; ++first)
+            {
+                invoke(fun, invoke(proj, *first));
+            }
+            return first;
+        }
+
+        template<typename Rng, typename F, typename P>
+        iterator_t<Rng> for_each_segments_(Rng & rng, F & fun, P & proj, std::true_type)
+        {
+            auto visit = [&](auto first, auto last) {
+                for(; first != last; ++first)
+                    invoke(fun, invoke(proj, *first));
+                return first;
+            };
+            return range_access::for_each_segment(rng, visit);
+        }
+
+        template<typename Rng, typename F, typename P>
+        iterator_t<Rng> for_each_range_(Rng & rng, F & fun, P & proj, std::false_type)
+        {
+            return detail::for_each_segments_(
+                rng, fun, proj, meta::bool_<detail::segmented_range_v<Rng>>{});
+        }
+
+        template<typename Rng, typename F, typename P>
+        iterator_t<Rng> for_each_range_(Rng & rng, F & fun, P & proj, std::true_type)
+        {
+            auto visit = [&](auto && elem) {
+                invoke(fun, invoke(proj, static_cast<decltype(elem)>(elem)));
+            };
+            return range_access::for_each_chunked(rng, visit);
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(for_each)
 
         /// \brief function template \c for_each
@@ -61,10 +111,55 @@ namespace ranges
         for_each_result<borrowed_iterator_t<Rng>, F> //
         RANGES_FUNC(for_each)(Rng && rng, F fun, P proj = P{})
         {
-            return {(*this)(begin(rng), end(rng), ref(fun), detail::move(proj)).in,
+            return {detail::for_each_range_(
+                        rng, fun, proj, meta::bool_<detail::chunked_range_v<Rng>>{}),
                     detail::move(fun)};
         }
 
+        /// \overload
+        /// With a parallel execution policy, the range is split into pieces
+        /// that are visited concurrently, so \c fun and \c proj may be invoked
+        /// from several threads at once.
+        template(typename ExecutionPolicy,
+                 typename I,
+                 typename S,
+                 typename F,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                random_access_iterator<I> AND sized_sentinel_for<S, I> AND
+                indirectly_unary_invocable<F, projected<I, P>>)
+        I RANGES_FUNC(for_each)(ExecutionPolicy &&, I first, S last, F fun, P proj = P{})
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(first), std::move(last), std::move(fun),
+                               std::move(proj))
+                    .in;
+            auto const n = last - first;
+            detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+                for(I i = first + lo, e = first + hi; i != e; ++i)
+                    invoke(fun, invoke(proj, *i));
+            });
+            return first + n;
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy, typename Rng, typename F, typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND random_access_range<Rng> AND
+                sized_range<Rng> AND
+                indirectly_unary_invocable<F, projected<iterator_t<Rng>, P>>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(for_each)(ExecutionPolicy && policy, Rng && rng, F fun, P proj = P{})
+        {
+            auto first = begin(rng);
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           first,
+                           first + ranges::distance(rng),
+                           std::move(fun),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(for_each)
 
     namespace cpp20
@@ -0,0 +1,90 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_FOR_EACH_BUFFERED_HPP
+#define RANGES_V3_ALGORITHM_FOR_EACH_BUFFERED_HPP
+
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/reference_wrapper.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/chunked.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        template<typename Rng, typename F, typename P>
+        for_each_result<borrowed_iterator_t<Rng>, F> //
+        for_each_buffered_(Rng & rng, F & fun, P & proj, std::true_type)
+        {
+            auto visit = [&](auto && elem) {
+                invoke(fun, invoke(proj, static_cast<decltype(elem)>(elem)));
+            };
+            return {range_access::for_each_buffered(rng, visit), detail::move(fun)};
+        }
+
+        template<typename Rng, typename F, typename P>
+        for_each_result<borrowed_iterator_t<Rng>, F> //
+        for_each_buffered_(Rng & rng, F & fun, P & proj, std::false_type)
+        {
+            auto res = ranges::for_each(rng, ref(fun), detail::move(proj));
+            return {detail::move(res.in), detail::move(fun)};
+        }
+    } // namespace detail
+    /// \endcond
+
+    RANGES_FUNC_BEGIN(for_each_buffered)
+
+        /// \brief function template \c for_each_buffered
+        ///
+        /// Like \c ranges::for_each, but a range whose elements cost an
+        /// indirect call each, like \c any_view, may be read in blocks of up
+        /// to 64 elements, a whole block before \c fun sees its first element.
+        /// So \c fun must not depend on which elements have been read yet, and
+        /// if it throws, the rest of the block has been read for nothing.
+        template(typename Rng, typename F, typename P = identity)(
+            /// \pre
+            requires input_range<Rng> AND
+            indirectly_unary_invocable<F, projected<iterator_t<Rng>, P>>)
+        for_each_result<borrowed_iterator_t<Rng>, F> //
+        RANGES_FUNC(for_each_buffered)(Rng && rng, F fun, P proj = P{})
+        {
+            return detail::for_each_buffered_<Rng>(
+                rng, fun, proj, meta::bool_<detail::buffered_range_v<Rng>>{});
+        }
+
+    RANGES_FUNC_END(for_each_buffered)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
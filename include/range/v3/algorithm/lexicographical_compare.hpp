@@ -25,10 +25,52 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        bool lexicographical_compare_(I0 begin0, S0 end0, I1 begin1, S1 end1, C & pred,
+                                      P0 & proj0, P1 & proj1, std::false_type)
+        {
+            for(; begin1 != end1; ++begin0, ++begin1)
+            {
+                if(begin0 == end0 ||
+                   invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
+                    return true;
+                if(invoke(pred, invoke(proj1, *begin1), invoke(proj0, *begin0)))
+                    return false;
+            }
+            return false;
+        }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        bool lexicographical_compare_(I0 begin0, S0 end0, I1 begin1, S1 end1, C &,
+                                      P0 &, P1 &, std::true_type)
+        {
+            auto const n0 = static_cast<std::size_t>(end0 - begin0);
+            auto const n1 = static_cast<std::size_t>(end1 - begin1);
+            auto const n = n0 < n1 ? n0 : n1;
+            if(n != 0)
+            {
+                auto const p0 = detail::simd_data(begin0);
+                auto const p1 = detail::simd_data(begin1);
+                auto const i = detail::simd_mismatch(p0, p1, n);
+                if(i != n)
+                    return p0[i] < p1[i];
+            }
+            return n0 < n1;
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(lexicographical_compare)
@@ -53,15 +95,16 @@ namespace ranges
                                                   P0 proj0 = P0{},
                                                   P1 proj1 = P1{})
         {
-            for(; begin1 != end1; ++begin0, ++begin1)
-            {
-                if(begin0 == end0 ||
-                   invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
-                    return true;
-                if(invoke(pred, invoke(proj1, *begin1), invoke(proj0, *begin0)))
-                    return false;
-            }
-            return false;
+            return detail::lexicographical_compare_(
+                std::move(begin0),
+                std::move(end0),
+                std::move(begin1),
+                std::move(end1),
+                pred,
+                proj0,
+                proj1,
+                meta::bool_<detail::is_simd_comparable<I0, S0, I1, S1, C, P0, P1>::value &&
+                            RANGES_IS_SAME(C, ranges::less)>{});
         }
 
         /// \overload
@@ -0,0 +1,224 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_LOWER_BOUND_MANY_HPP
+#define RANGES_V3_ALGORITHM_LOWER_BOUND_MANY_HPP
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/gallop.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // How many binary searches lower_bound_batch runs side by side.
+        RANGES_INLINE_VAR constexpr int lower_bound_batch_width = 16;
+
+        template<typename I>
+        void lower_bound_prefetch_(I const & it, std::true_type)
+        {
+            RANGES_PREFETCH(std::addressof(*it));
+        }
+        template<typename I>
+        void lower_bound_prefetch_(I const &, std::false_type)
+        {}
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-algorithms
+    /// @{
+    template<typename I, typename O>
+    using lower_bound_many_result = detail::in_out_result<I, O>;
+
+    RANGES_FUNC_BEGIN(lower_bound_many)
+
+        /// \brief function template \c lower_bound_many
+        ///
+        /// Writes to \c out the lower bound in <tt>[first, last)</tt> of each
+        /// needle in <tt>[nfirst, nlast)</tt>, which must be sorted. Each search
+        /// starts where the one before it ended and gallops from there, so the
+        /// m needles cost O(m log(n/m)) comparisons in all with random access,
+        /// and one merge-like pass over the haystack without.
+        template(typename I,
+                 typename S,
+                 typename I2,
+                 typename S2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_iterator<I> AND sentinel_for<S, I> AND
+                input_iterator<I2> AND sentinel_for<S2, I2> AND
+                output_iterator<O, I const &> AND
+                indirect_strict_weak_order<C, I2, projected<I, P>>)
+        lower_bound_many_result<I2, O> RANGES_FUNC(lower_bound_many)(I first,
+                                                                     S last,
+                                                                     I2 nfirst,
+                                                                     S2 nlast,
+                                                                     O out,
+                                                                     C pred = C{},
+                                                                     P proj = P{})
+        {
+            for(; nfirst != nlast; ++nfirst, ++out)
+            {
+                first = detail::gallop(std::move(first), last, *nfirst, pred, proj);
+                *out = first;
+            }
+            return {nfirst, out};
+        }
+
+        /// \overload
+        template(typename Rng,
+                 typename Rng2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_range<Rng> AND borrowed_range<Rng> AND
+                input_range<Rng2> AND output_iterator<O, iterator_t<Rng> const &> AND
+                indirect_strict_weak_order<C, iterator_t<Rng2>, projected<iterator_t<Rng>, P>>)
+        lower_bound_many_result<borrowed_iterator_t<Rng2>, O> //
+        RANGES_FUNC(lower_bound_many)(
+            Rng && rng, Rng2 && needles, O out, C pred = C{}, P proj = P{})
+        {
+            return (*this)(begin(rng),
+                           end(rng),
+                           begin(needles),
+                           end(needles),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+    RANGES_FUNC_END(lower_bound_many)
+
+    RANGES_FUNC_BEGIN(lower_bound_batch)
+
+        /// \brief function template \c lower_bound_batch
+        ///
+        /// Writes to \c out the lower bound in <tt>[first, last)</tt> of each
+        /// needle in <tt>[nfirst, nlast)</tt>, in any order. The binary searches
+        /// of a batch of needles run side by side without branching on the
+        /// comparisons, so that the memory accesses of one overlap with those of
+        /// the others, and the next element each one reads is prefetched when
+        /// the haystack is contiguous. For sorted needles, \c lower_bound_many
+        /// does less work.
+        template(typename I,
+                 typename S,
+                 typename I2,
+                 typename S2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires random_access_iterator<I> AND sized_sentinel_for<S, I> AND
+                forward_iterator<I2> AND sentinel_for<S2, I2> AND
+                output_iterator<O, I const &> AND
+                indirect_strict_weak_order<C, I2, projected<I, P>>)
+        lower_bound_many_result<I2, O> RANGES_FUNC(lower_bound_batch)(I first,
+                                                                      S last,
+                                                                      I2 nfirst,
+                                                                      S2 nlast,
+                                                                      O out,
+                                                                      C pred = C{},
+                                                                      P proj = P{})
+        {
+            using prefetch = meta::bool_<contiguous_iterator<I>>;
+            constexpr int width = detail::lower_bound_batch_width;
+            auto const n = last - first;
+            I2 needles[width];
+            I bases[width];
+            while(nfirst != nlast)
+            {
+                int m = 0;
+                for(; m != width && nfirst != nlast; ++m, ++nfirst)
+                {
+                    needles[m] = nfirst;
+                    bases[m] = first;
+                }
+                // Halve every search's interval in turn, keeping its lower
+                // half when the middle element is not less than the needle.
+                for(auto len = n; len > 1;)
+                {
+                    auto const half = len / 2;
+                    len -= half;
+                    for(int j = 0; j != m; ++j)
+                    {
+                        bases[j] += invoke(pred, invoke(proj, bases[j][half]), *needles[j])
+                                        ? half
+                                        : 0;
+                        detail::lower_bound_prefetch_(bases[j] + len / 2, prefetch{});
+                    }
+                }
+                for(int j = 0; j != m; ++j, ++out)
+                    *out = n != 0 && invoke(pred, invoke(proj, *bases[j]), *needles[j])
+                               ? bases[j] + 1
+                               : bases[j];
+            }
+            return {nfirst, out};
+        }
+
+        /// \overload
+        template(typename Rng,
+                 typename Rng2,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires random_access_range<Rng> AND sized_range<Rng> AND
+                borrowed_range<Rng> AND forward_range<Rng2> AND
+                output_iterator<O, iterator_t<Rng> const &> AND
+                indirect_strict_weak_order<C, iterator_t<Rng2>, projected<iterator_t<Rng>, P>>)
+        lower_bound_many_result<borrowed_iterator_t<Rng2>, O> //
+        RANGES_FUNC(lower_bound_batch)(
+            Rng && rng, Rng2 && needles, O out, C pred = C{}, P proj = P{})
+        {
+            auto first = begin(rng);
+            return (*this)(first,
+                           first + ranges::distance(rng),
+                           begin(needles),
+                           end(needles),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+    RANGES_FUNC_END(lower_bound_batch)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,92 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_MERGE_K_HPP
+#define RANGES_V3_ALGORITHM_MERGE_K_HPP
+
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/loser_tree.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+    template<typename I, typename O>
+    using merge_k_result = detail::in_out_result<I, O>;
+
+    RANGES_FUNC_BEGIN(merge_k)
+
+        /// \brief function template \c merge_k
+        ///
+        /// Merges the sorted ranges of \c rngs into \c out, with O(log k)
+        /// comparisons per element for k ranges. Equal elements are written
+        /// in the order of the ranges they come from.
+        template(typename Rngs,
+                 typename O,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires forward_range<Rngs> AND
+                borrowed_range<range_reference_t<Rngs>> AND
+                mergeable<iterator_t<range_reference_t<Rngs>>,
+                          iterator_t<range_reference_t<Rngs>>, O, C, P, P>)
+        merge_k_result<borrowed_iterator_t<Rngs>, O> //
+        RANGES_FUNC(merge_k)(Rngs && rngs, O out, C pred = C{}, P proj = P{})
+        {
+            detail::loser_tree<iterator_t<range_reference_t<Rngs>>,
+                               sentinel_t<range_reference_t<Rngs>>>
+                tree;
+            auto it = ranges::begin(rngs);
+            auto const last = ranges::end(rngs);
+            for(; it != last; ++it)
+            {
+                auto && rng = *it;
+                tree.push_back(ranges::begin(rng), ranges::end(rng));
+            }
+            tree.build(pred, proj);
+            for(; tree.active() > 1; ++out)
+            {
+                *out = *tree.top().it;
+                tree.pop(pred, proj);
+            }
+            // The last run left needs no more comparisons.
+            if(tree.active() == 1)
+                out = ranges::copy(std::move(tree.top().it), tree.top().end,
+                                   std::move(out))
+                          .out;
+            return {it, out};
+        }
+
+    RANGES_FUNC_END(merge_k)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
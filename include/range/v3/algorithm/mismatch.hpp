@@ -31,6 +31,8 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/simd.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -40,6 +42,39 @@ namespace ranges
     template<typename I1, typename I2>
     using mismatch_result = detail::in1_in2_result<I1, I2>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I1, typename S1, typename I2, typename S2, typename C,
+                 typename P1, typename P2>
+        mismatch_result<I1, I2> mismatch_(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                                          C & pred, P1 & proj1, P2 & proj2,
+                                          std::false_type)
+        {
+            for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
+                if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                    break;
+            return {begin1, begin2};
+        }
+
+        template<typename I1, typename S1, typename I2, typename S2, typename C,
+                 typename P1, typename P2>
+        mismatch_result<I1, I2> mismatch_(I1 begin1, S1 end1, I2 begin2, S2 end2, C &,
+                                          P1 &, P2 &, std::true_type)
+        {
+            auto const n1 = end1 - begin1;
+            auto const n2 = end2 - begin2;
+            auto const n = static_cast<std::size_t>(n1 < n2 ? n1 : n2);
+            if(n == 0)
+                return {begin1, begin2};
+            auto const i = detail::simd_mismatch(
+                detail::simd_data(begin1), detail::simd_data(begin2), n);
+            return {begin1 + static_cast<iter_difference_t<I1>>(i),
+                    begin2 + static_cast<iter_difference_t<I2>>(i)};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_FUNC_BEGIN(mismatch)
 
         /// \brief function template \c mismatch
@@ -89,10 +124,16 @@ namespace ranges
                                                       P1 proj1 = P1{},
                                                       P2 proj2 = P2{}) //
         {
-            for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
-                if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
-                    break;
-            return {begin1, begin2};
+            return detail::mismatch_(
+                std::move(begin1),
+                std::move(end1),
+                std::move(begin2),
+                std::move(end2),
+                pred,
+                proj1,
+                proj2,
+                meta::bool_<detail::is_simd_comparable<I1, S1, I2, S2, C, P1, P2>::value &&
+                            RANGES_IS_SAME(C, ranges::equal_to)>{});
         }
 
         /// \overload
@@ -27,6 +27,8 @@
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/trivial_copy.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -36,6 +38,27 @@ namespace ranges
     template<typename I, typename O>
     using move_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O>
+        move_result<I, O> move_(I first, S last, O out, std::false_type)
+        {
+            for(; first != last; ++first, ++out)
+                *out = iter_move(first);
+            return {first, out};
+        }
+
+        template<typename I, typename S, typename O>
+        move_result<I, O> move_(I first, S last, O out, std::true_type)
+        {
+            auto const n = last - first;
+            out = detail::memmove_n(first, n, out);
+            return {first + n, out};
+        }
+    } // namespace detail
+    /// \endcond
+
     RANGES_HIDDEN_DETAIL(namespace _move CPP_PP_LBRACE())
     RANGES_FUNC_BEGIN(move)
 
@@ -46,9 +69,10 @@ namespace ranges
             weakly_incrementable<O> AND indirectly_movable<I, O>)
         move_result<I, O> RANGES_FUNC(move)(I first, S last, O out) //
         {
-            for(; first != last; ++first, ++out)
-                *out = iter_move(first);
-            return {first, out};
+            return detail::move_(std::move(first),
+                                 std::move(last),
+                                 std::move(out),
+                                 detail::is_memmovable<I, S, O, true>{});
         }
 
         /// \overload
@@ -0,0 +1,86 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+#define RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+
+#include <memory>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/aux_/radix_sort_n_with_buffer.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+
+    // LSD radix sort on the bytes of an arithmetic key. Stable, and linear in
+    // the number of elements, at the cost of a temporary buffer as large as the
+    // input. If the buffer cannot be had, falls back to stable_sort.
+
+    RANGES_FUNC_BEGIN(radix_sort)
+
+        /// \brief function template \c radix_sort
+        template(typename I, typename S, typename P = identity)(
+            /// \pre
+            requires sortable<I, less, P> AND random_access_iterator<I> AND
+                sentinel_for<S, I> AND (detail::radix_sortable_v<I, P>))
+        I RANGES_FUNC(radix_sort)(I first, S end_, P proj = P{})
+        {
+            I last = ranges::next(first, std::move(end_));
+            using D = iter_difference_t<I>;
+            using V = iter_value_t<I>;
+            D len = last - first;
+            if(len < 2)
+                return last;
+            auto buf = detail::get_temporary_buffer<V>(len);
+            std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            if(buf.second < len)
+                return stable_sort(first, last, less{}, std::move(proj));
+            detail::radix_sort_with_buffer(first, len, buf.first, proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename Rng, typename P = identity)(
+            /// \pre
+            requires sortable<iterator_t<Rng>, less, P> AND random_access_range<Rng> AND
+                (detail::radix_sortable_v<iterator_t<Rng>, P>))
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(radix_sort)(Rng && rng, P proj = P{}) //
+        {
+            return (*this)(begin(rng), end(rng), std::move(proj));
+        }
+
+    RANGES_FUNC_END(radix_sort)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <cmath>
+#include <cstdint>
 #include <utility>
 
 #include <range/v3/range_fwd.hpp>
@@ -51,14 +53,14 @@ namespace ranges
         {
             if(pop_size > 0 && sample_size > 0)
             {
-                std::uniform_int_distribution<iter_difference_t<I>> dist;
-                using param_t = typename decltype(dist)::param_type;
                 for(; first != last; ++first)
                 {
                     if(sample_size >= pop_size)
                         return copy_n(std::move(first), pop_size, std::move(out));
 
-                    if(dist(gen, param_t{0, --pop_size}) < sample_size)
+                    auto const i =
+                        detail::bounded_random(gen, static_cast<std::uint64_t>(pop_size--));
+                    if(i < static_cast<std::uint64_t>(sample_size))
                     {
                         *out = *first;
                         ++out;
@@ -70,6 +72,30 @@ namespace ranges
 
             return {std::move(first), std::move(out)};
         }
+
+        // The skip-ahead reservoir sampling of Li's Algorithm L ("Reservoir-
+        // Sampling Algorithms of Time Complexity O(n(1 + log(N/n)))", 1994):
+        // once a reservoir of n elements is full, the number of elements to
+        // pass over before the next one that replaces a random element of the
+        // reservoir is drawn directly, which takes O(n(1 + log(N/n))) random
+        // numbers for N elements instead of N.
+
+        // The factor the weight starts at and is multiplied by at each
+        // replacement, for a reservoir of n elements.
+        template<typename Gen>
+        double reservoir_weight(Gen & gen, double n)
+        {
+            return std::exp(std::log(detail::random_unit(gen)) / n);
+        }
+
+        // The number of elements to pass over before the next replacement.
+        template<typename Gen>
+        std::uint64_t reservoir_skip(Gen & gen, double weight)
+        {
+            double const skip =
+                std::floor(std::log(detail::random_unit(gen)) / std::log1p(-weight));
+            return skip < 9e18 ? static_cast<std::uint64_t>(skip) : UINT64_MAX;
+        }
     } // namespace detail
     /// \endcond
 
@@ -118,13 +144,21 @@ namespace ranges
                         *next(out, i) = *first;
                     }
 
-                    std::uniform_int_distribution<iter_difference_t<O>> dist;
-                    using param_t = typename decltype(dist)::param_type;
-                    for(auto pop_size = n; first != last; (void)++first, ++pop_size)
+                    // The reservoir is full; skip ahead to each replacement.
+                    auto const m = static_cast<std::uint64_t>(n);
+                    double weight = detail::reservoir_weight(gen, static_cast<double>(m));
+                    while(true)
                     {
-                        auto const i = dist(gen, param_t{0, pop_size});
-                        if(i < n)
-                            *next(out, i) = *first;
+                        for(auto skip = detail::reservoir_skip(gen, weight);
+                            skip != 0 && first != last;
+                            --skip)
+                            ++first;
+                        if(first == last)
+                            break;
+                        auto const i = detail::bounded_random(gen, m);
+                        *next(out, static_cast<iter_difference_t<O>>(i)) = *first;
+                        ++first;
+                        weight *= detail::reservoir_weight(gen, static_cast<double>(m));
                     }
 
                     advance(out, n);
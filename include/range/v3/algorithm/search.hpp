@@ -28,6 +28,7 @@
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/searcher.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
@@ -140,6 +141,42 @@ namespace ranges
                 }
             }
         }
+
+        template<typename I1, typename S1, typename D1, typename I2, typename S2,
+                 typename D2, typename C, typename P1, typename P2>
+        subrange<I1> search_sized_(I1 begin1, S1 end1, D1 d1, I2 begin2, S2 end2, D2 d2,
+                                   C & pred, P1 & proj1, P2 & proj2, std::false_type)
+        {
+            return detail::search_sized_impl(std::move(begin1),
+                                             std::move(end1),
+                                             d1,
+                                             std::move(begin2),
+                                             std::move(end2),
+                                             d2,
+                                             pred,
+                                             proj1,
+                                             proj2);
+        }
+
+        template<typename I1, typename S1, typename D1, typename I2, typename S2,
+                 typename D2, typename C, typename P1, typename P2>
+        subrange<I1> search_sized_(I1 begin1, S1 end1, D1 d1, I2 begin2, S2 end2, D2 d2,
+                                   C & pred, P1 & proj1, P2 & proj2, std::true_type)
+        {
+            if(d2 >= searcher_threshold && d1 >= d2)
+                return detail::searcher_search(
+                    std::move(begin1), d1, std::move(begin2), d2, proj1, proj2);
+            return detail::search_sized_(std::move(begin1),
+                                         std::move(end1),
+                                         d1,
+                                         std::move(begin2),
+                                         std::move(end2),
+                                         d2,
+                                         pred,
+                                         proj1,
+                                         proj2,
+                                         std::false_type{});
+        }
     } // namespace detail
     /// \endcond
 
@@ -169,15 +206,17 @@ namespace ranges
                 return {begin1, begin1};
             if(RANGES_CONSTEXPR_IF(sized_sentinel_for<S1, I1> &&
                                    sized_sentinel_for<S2, I2>))
-                return detail::search_sized_impl(std::move(begin1),
-                                                 std::move(end1),
-                                                 distance(begin1, end1),
-                                                 std::move(begin2),
-                                                 std::move(end2),
-                                                 distance(begin2, end2),
-                                                 pred,
-                                                 proj1,
-                                                 proj2);
+                return detail::search_sized_(
+                    std::move(begin1),
+                    std::move(end1),
+                    distance(begin1, end1),
+                    std::move(begin2),
+                    std::move(end2),
+                    distance(begin2, end2),
+                    pred,
+                    proj1,
+                    proj2,
+                    detail::prefer_searcher<I1, I2, C, P1, P2>{});
             else
                 return detail::search_impl(std::move(begin1),
                                            std::move(end1),
@@ -203,20 +242,45 @@ namespace ranges
             if(empty(rng2))
                 return subrange<iterator_t<Rng1>>{begin(rng1), begin(rng1)};
             if(RANGES_CONSTEXPR_IF(sized_range<Rng1> && sized_range<Rng2>))
-                return detail::search_sized_impl(begin(rng1),
-                                                 end(rng1),
-                                                 distance(rng1),
-                                                 begin(rng2),
-                                                 end(rng2),
-                                                 distance(rng2),
-                                                 pred,
-                                                 proj1,
-                                                 proj2);
+                return detail::search_sized_(
+                    begin(rng1),
+                    end(rng1),
+                    distance(rng1),
+                    begin(rng2),
+                    end(rng2),
+                    distance(rng2),
+                    pred,
+                    proj1,
+                    proj2,
+                    detail::prefer_searcher<iterator_t<Rng1>, iterator_t<Rng2>, C, P1,
+                                            P2>{});
             else
                 return detail::search_impl(
                     begin(rng1), end(rng1), begin(rng2), end(rng2), pred, proj1, proj2);
         }
 
+        /// \overload
+        template(typename I1, typename S1, typename Searcher, typename P1 = identity)(
+            /// \pre
+            requires forward_iterator<I1> AND sentinel_for<S1, I1> AND
+                searcher_for<Searcher, I1, S1, P1>)
+        subrange<I1> RANGES_FUNC(search)(
+            I1 begin1, S1 end1, Searcher const & searcher, P1 proj1 = P1{}) //
+        {
+            return searcher(std::move(begin1), std::move(end1), std::move(proj1));
+        }
+
+        /// \overload
+        template(typename Rng1, typename Searcher, typename P1 = identity)(
+            /// \pre
+            requires forward_range<Rng1> AND
+                searcher_for<Searcher, iterator_t<Rng1>, sentinel_t<Rng1>, P1>)
+        borrowed_subrange_t<Rng1> RANGES_FUNC(search)(
+            Rng1 && rng1, Searcher const & searcher, P1 proj1 = P1{}) //
+        {
+            return searcher(begin(rng1), end(rng1), std::move(proj1));
+        }
+
     RANGES_FUNC_END(search)
 
     namespace cpp20
@@ -38,6 +38,8 @@
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/gallop.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -216,20 +218,41 @@ namespace ranges
                                         P1 proj1 = P1{},
                                         P2 proj2 = P2{}) //
         {
+            detail::gallop_mode mode;
+            // Whether *begin2 is known not to be less than *begin1
+            bool not_less2 = false;
             while(begin1 != end1 && begin2 != end2)
             {
                 if(invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
-                    ++begin1;
-                else
                 {
-                    if(!invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
+                    not_less2 = false;
+                    if(!mode.win(1))
                     {
-                        *out = *begin1;
-                        ++out;
                         ++begin1;
+                        continue;
                     }
+                    begin1 =
+                        mode.skip(std::move(begin1), end1, invoke(proj2, *begin2), pred, proj1);
+                    if(begin1 == end1)
+                        break;
+                }
+                if(not_less2 || !invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
+                {
+                    mode.tie();
+                    not_less2 = false;
+                    *out = *begin1;
+                    ++out;
+                    ++begin1;
                     ++begin2;
                 }
+                else if(mode.win(2))
+                {
+                    begin2 =
+                        mode.skip(std::move(begin2), end2, invoke(proj1, *begin1), pred, proj2);
+                    not_less2 = true;
+                }
+                else
+                    ++begin2;
             }
             return out;
         }
@@ -294,6 +317,9 @@ namespace ranges
                                                                  P1 proj1 = P1{},
                                                                  P2 proj2 = P2{}) //
         {
+            detail::gallop_mode mode;
+            // Whether *begin2 is known not to be less than *begin1
+            bool not_less2 = false;
             while(begin1 != end1)
             {
                 if(begin2 == end2)
@@ -303,16 +329,28 @@ namespace ranges
                 }
                 if(invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
                 {
+                    mode.tie();
+                    not_less2 = false;
                     *out = *begin1;
                     ++out;
                     ++begin1;
                 }
-                else
+                else if(not_less2 ||
+                        !invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
                 {
-                    if(!invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
-                        ++begin1;
+                    mode.tie();
+                    not_less2 = false;
+                    ++begin1;
                     ++begin2;
                 }
+                else if(mode.win(2))
+                {
+                    begin2 =
+                        mode.skip(std::move(begin2), end2, invoke(proj1, *begin1), pred, proj2);
+                    not_less2 = true;
+                }
+                else
+                    ++begin2;
             }
             return {begin1, out};
         }
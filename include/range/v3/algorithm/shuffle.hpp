@@ -20,6 +20,7 @@
 
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
@@ -33,6 +34,15 @@
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        // The largest bound for which shuffle draws two indices per random word.
+        RANGES_INLINE_VAR constexpr std::ptrdiff_t shuffle_batch_limit =
+            std::ptrdiff_t{1} << 30;
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     RANGES_FUNC_BEGIN(shuffle)
@@ -48,21 +58,32 @@ namespace ranges
                                S const last,
                                Gen && gen = detail::get_random_engine()) //
         {
-            auto mid = first;
-            if(mid == last)
-                return mid;
             using D1 = iter_difference_t<I>;
             using D2 =
                 meta::conditional_t<std::is_integral<D1>::value, D1, std::ptrdiff_t>;
-            std::uniform_int_distribution<D2> uid{};
-            using param_t = typename decltype(uid)::param_type;
-            while(++mid != last)
+            auto const size = static_cast<D2>(distance(first, last));
+            // Swap each element with a random one of those before it or itself,
+            // drawing the indices for two elements at a time while the product
+            // of their bounds is small enough.
+            D2 i = 1;
+            for(; i + 1 < size && i + 2 <= detail::shuffle_batch_limit; i += 2)
+            {
+                auto const j = detail::bounded_random_2(gen,
+                                                        static_cast<std::uint64_t>(i + 1),
+                                                        static_cast<std::uint64_t>(i + 2));
+                if(static_cast<D2>(j.first) != i)
+                    ranges::iter_swap(first + i, first + static_cast<D2>(j.first));
+                if(static_cast<D2>(j.second) != i + 1)
+                    ranges::iter_swap(first + (i + 1), first + static_cast<D2>(j.second));
+            }
+            for(; i < size; ++i)
             {
-                RANGES_ENSURE(mid - first <= PTRDIFF_MAX);
-                if(auto const i = uid(gen, param_t{0, D2(mid - first)}))
-                    ranges::iter_swap(mid - i, mid);
+                auto const j = static_cast<D2>(
+                    detail::bounded_random(gen, static_cast<std::uint64_t>(i + 1)));
+                if(j != i)
+                    ranges::iter_swap(first + i, first + j);
             }
-            return mid;
+            return first + size;
         }
 
         /// \overload
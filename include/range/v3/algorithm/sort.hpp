@@ -36,8 +36,14 @@
 #ifndef RANGES_V3_ALGORITHM_SORT_HPP
 #define RANGES_V3_ALGORITHM_SORT_HPP
 
+#include <cstddef>
+#include <utility>
+
+#include <meta/meta.hpp>
+
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/radix_sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
 #include <range/v3/algorithm/partial_sort.hpp>
@@ -51,10 +57,18 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 #include <range/v3/detail/prologue.hpp>
 
+/// \def RANGES_SORT_USE_PDQSORT
+/// When non-zero (the default), \c ranges::sort is a pattern-defeating
+/// quicksort. When zero, it is the introsort it used to be.
+#ifndef RANGES_SORT_USE_PDQSORT
+#define RANGES_SORT_USE_PDQSORT 1
+#endif
+
 namespace ranges
 {
     /// \cond
@@ -181,14 +195,464 @@ namespace ranges
                 last = cut;
             }
         }
+
+        template<typename I, typename C, typename P>
+        void introsort(I first, I last, C & pred, P & proj)
+        {
+            detail::introsort_loop(
+                first, last, detail::log2(last - first) * 2, pred, proj);
+            detail::final_insertion_sort(first, last, pred, proj);
+        }
+
+        // Pattern-defeating quicksort (Orson Peters, 2021). Like introsort, but
+        // it recognizes runs that are already in order, groups elements equal
+        // to the pivot in linear time, and breaks up inputs that keep yielding
+        // lopsided partitions by swapping a few elements around before falling
+        // back to heapsort.
+
+        constexpr std::ptrdiff_t pdqsort_insertion_threshold()
+        {
+            return 24;
+        }
+
+        // Above this size, the pivot is the pseudomedian of nine.
+        constexpr std::ptrdiff_t pdqsort_ninther_threshold()
+        {
+            return 128;
+        }
+
+        // How many element moves partial_insertion_sort may make before it
+        // gives up on a range being nearly sorted.
+        constexpr std::ptrdiff_t pdqsort_partial_insertion_limit()
+        {
+            return 8;
+        }
+
+        constexpr std::ptrdiff_t pdqsort_block_size()
+        {
+            return 64;
+        }
+
+        // Whether comparisons are cheap and free of side effects, so that the
+        // partition can evaluate them without branching on the outcome.
+        template<typename I, typename C, typename P, bool = radix_sortable_v<I, P>>
+        struct pdqsort_branchless : std::false_type
+        {};
+
+        template<typename I, typename C, typename P>
+        struct pdqsort_branchless<I, C, P, true>
+          : meta::bool_<is_radix_less_v<C, radix_projected_key_t<I, P>> ||
+                        RANGES_IS_SAME(C, ranges::greater) ||
+                        RANGES_IS_SAME(C, std::greater<>) ||
+                        RANGES_IS_SAME(C, std::greater<radix_projected_key_t<I, P>>)>
+        {};
+
+        template<typename I, typename C, typename P>
+        inline void pdqsort_sort2(I a, I b, C & pred, P & proj)
+        {
+            if(invoke(pred, invoke(proj, *b), invoke(proj, *a)))
+                ranges::iter_swap(a, b);
+        }
+
+        template<typename I, typename C, typename P>
+        inline void pdqsort_sort3(I a, I b, I c, C & pred, P & proj)
+        {
+            detail::pdqsort_sort2(a, b, pred, proj);
+            detail::pdqsort_sort2(b, c, pred, proj);
+            detail::pdqsort_sort2(a, b, pred, proj);
+        }
+
+        // Insertion sort that gives up, returning false, once it has moved more
+        // than pdqsort_partial_insertion_limit() elements.
+        template<typename I, typename C, typename P>
+        bool pdqsort_partial_insertion_sort(I first, I last, C & pred, P & proj)
+        {
+            if(first == last)
+                return true;
+            std::ptrdiff_t moved = 0;
+            for(I cur = first + 1; cur != last; ++cur)
+            {
+                I sift = cur;
+                I sift_1 = cur - 1;
+                if(invoke(pred, invoke(proj, *sift), invoke(proj, *sift_1)))
+                {
+                    iter_value_t<I> tmp = iter_move(sift);
+                    do
+                    {
+                        *sift-- = iter_move(sift_1);
+                    } while(sift != first &&
+                            invoke(pred, invoke(proj, tmp), invoke(proj, *--sift_1)));
+                    *sift = std::move(tmp);
+                    moved += cur - sift;
+                }
+                if(moved > detail::pdqsort_partial_insertion_limit())
+                    return false;
+            }
+            return true;
+        }
+
+        // Partitions [first, last) around the pivot *first into elements less
+        // than the pivot and elements not less than it. Returns the pivot's new
+        // position and whether the range was already partitioned. The pivot
+        // is a median, so each scan meets an element that stops it before
+        // running off the range.
+        template<typename I, typename C, typename P>
+        std::pair<I, bool> pdqsort_partition_right(I first, I last, C & pred, P & proj,
+                                                   std::false_type)
+        {
+            I const begin = first;
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            while(invoke(pred, invoke(proj, *++first), pv))
+                ;
+            if(first - 1 == begin)
+                while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            else
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            bool const already_partitioned = first >= last;
+            while(first < last)
+            {
+                ranges::iter_swap(first, last);
+                while(invoke(pred, invoke(proj, *++first), pv))
+                    ;
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            }
+            I pivot_pos = first - 1;
+            *begin = iter_move(pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        // Swaps num pairs of misplaced elements found by the block partition.
+        // With use_swaps false, the pairs are instead rotated through a
+        // temporary, which takes fewer moves.
+        template<typename I>
+        void pdqsort_swap_offsets(I first, I last, unsigned char const * offsets_l,
+                                  unsigned char const * offsets_r, std::ptrdiff_t num,
+                                  bool use_swaps)
+        {
+            if(use_swaps)
+            {
+                for(std::ptrdiff_t i = 0; i < num; ++i)
+                    ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+            }
+            else if(num > 0)
+            {
+                I l = first + offsets_l[0];
+                I r = last - offsets_r[0];
+                iter_value_t<I> tmp = iter_move(l);
+                *l = iter_move(r);
+                for(std::ptrdiff_t i = 1; i < num; ++i)
+                {
+                    l = first + offsets_l[i];
+                    *r = iter_move(l);
+                    r = last - offsets_r[i];
+                    *l = iter_move(r);
+                }
+                *r = std::move(tmp);
+            }
+        }
+
+        // The same partition, done a block at a time (Edelkamp and Weiss,
+        // "BlockQuicksort", 2016). The comparisons of a block only record the
+        // offsets of misplaced elements, so the loop has no branch on their
+        // outcome for the CPU to mispredict.
+        template<typename I, typename C, typename P>
+        std::pair<I, bool> pdqsort_partition_right(I first, I last, C & pred, P & proj,
+                                                   std::true_type)
+        {
+            I const begin = first;
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            while(invoke(pred, invoke(proj, *++first), pv))
+                ;
+            if(first - 1 == begin)
+                while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            else
+                while(!invoke(pred, invoke(proj, *--last), pv))
+                    ;
+            bool const already_partitioned = first >= last;
+            if(!already_partitioned)
+            {
+                ranges::iter_swap(first, last);
+                ++first;
+
+                constexpr std::ptrdiff_t block = detail::pdqsort_block_size();
+                unsigned char offsets_l[block];
+                unsigned char offsets_r[block];
+                I offsets_l_base = first;
+                I offsets_r_base = last;
+                std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+                while(first < last)
+                {
+                    std::ptrdiff_t const unknown = last - first;
+                    std::ptrdiff_t const left_split =
+                        num_l == 0 ? (num_r == 0 ? unknown / 2 : unknown) : 0;
+                    std::ptrdiff_t const right_split =
+                        num_r == 0 ? (unknown - left_split) : 0;
+
+                    std::ptrdiff_t const n_l = left_split < block ? left_split : block;
+                    for(std::ptrdiff_t i = 0; i < n_l; ++i, ++first)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i);
+                        num_l += !invoke(pred, invoke(proj, *first), pv);
+                    }
+                    std::ptrdiff_t const n_r = right_split < block ? right_split : block;
+                    for(std::ptrdiff_t i = 1; i <= n_r; ++i)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(i);
+                        num_r += invoke(pred, invoke(proj, *--last), pv);
+                    }
+
+                    std::ptrdiff_t const num = num_l < num_r ? num_l : num_r;
+                    detail::pdqsort_swap_offsets(offsets_l_base,
+                                                 offsets_r_base,
+                                                 offsets_l + start_l,
+                                                 offsets_r + start_r,
+                                                 num,
+                                                 num_l == num_r);
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+                    if(num_l == 0)
+                    {
+                        start_l = 0;
+                        offsets_l_base = first;
+                    }
+                    if(num_r == 0)
+                    {
+                        start_r = 0;
+                        offsets_r_base = last;
+                    }
+                }
+
+                // Whichever side still has misplaced elements, move them to
+                // the boundary.
+                if(num_l != 0)
+                {
+                    while(num_l--)
+                        ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l],
+                                          --last);
+                    first = last;
+                }
+                if(num_r != 0)
+                {
+                    while(num_r--)
+                        ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r],
+                                          first),
+                            ++first;
+                    last = first;
+                }
+            }
+            I pivot_pos = first - 1;
+            *begin = iter_move(pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        // Puts the elements equal to the pivot *first to the left and the
+        // greater ones to the right, given that nothing in the range is less
+        // than the pivot. Returns the last position of the equal elements.
+        template<typename I, typename C, typename P>
+        I pdqsort_partition_left(I first, I last, C & pred, P & proj)
+        {
+            I const begin = first, end = last;
+            iter_value_t<I> pivot = iter_move(begin);
+            auto && pv = invoke(proj, pivot);
+            while(invoke(pred, pv, invoke(proj, *--last)))
+                ;
+            if(last + 1 == end)
+                while(first < last && !invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            else
+                while(!invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            while(first < last)
+            {
+                ranges::iter_swap(first, last);
+                while(invoke(pred, pv, invoke(proj, *--last)))
+                    ;
+                while(!invoke(pred, pv, invoke(proj, *++first)))
+                    ;
+            }
+            *begin = iter_move(last);
+            *last = std::move(pivot);
+            return last;
+        }
+
+        // Breaks up a pattern that produced a lopsided partition by swapping a
+        // few elements at fixed positions in the partition of [first, last).
+        template<typename I>
+        void pdqsort_break_patterns(I first, I last)
+        {
+            auto const n = last - first;
+            if(n < detail::pdqsort_insertion_threshold())
+                return;
+            ranges::iter_swap(first, first + n / 4);
+            ranges::iter_swap(last - 1, last - n / 4);
+            if(n > detail::pdqsort_ninther_threshold())
+            {
+                ranges::iter_swap(first + 1, first + (n / 4 + 1));
+                ranges::iter_swap(first + 2, first + (n / 4 + 2));
+                ranges::iter_swap(last - 2, last - (n / 4 + 1));
+                ranges::iter_swap(last - 3, last - (n / 4 + 2));
+            }
+        }
+
+        // leftmost is whether [first, last) starts the whole sequence. When it
+        // does not, *(first - 1) is a previous pivot, not greater than anything
+        // in the range, which serves as a sentinel.
+        template<typename I, typename C, typename P, typename Branchless>
+        void pdqsort_loop(I first, I last, int bad_allowed, bool leftmost, C & pred,
+                          P & proj, Branchless branchless)
+        {
+            while(true)
+            {
+                auto const size = last - first;
+                if(size < detail::pdqsort_insertion_threshold())
+                {
+                    if(leftmost)
+                        detail::insertion_sort(first, last, pred, proj);
+                    else
+                        detail::unguarded_insertion_sort(first, last, pred, proj);
+                    return;
+                }
+
+                // Move the pivot to *first.
+                auto const half = size / 2;
+                if(size > detail::pdqsort_ninther_threshold())
+                {
+                    detail::pdqsort_sort3(first, first + half, last - 1, pred, proj);
+                    detail::pdqsort_sort3(
+                        first + 1, first + (half - 1), last - 2, pred, proj);
+                    detail::pdqsort_sort3(
+                        first + 2, first + (half + 1), last - 3, pred, proj);
+                    detail::pdqsort_sort3(
+                        first + (half - 1), first + half, first + (half + 1), pred, proj);
+                    ranges::iter_swap(first, first + half);
+                }
+                else
+                    detail::pdqsort_sort3(first + half, first, last - 1, pred, proj);
+
+                // If the pivot equals the previous pivot, everything equal to it
+                // is already in its final place once grouped on the left, and
+                // nothing is less than it.
+                if(!leftmost &&
+                   !invoke(pred, invoke(proj, *(first - 1)), invoke(proj, *first)))
+                {
+                    first = detail::pdqsort_partition_left(first, last, pred, proj) + 1;
+                    continue;
+                }
+
+                auto const part =
+                    detail::pdqsort_partition_right(first, last, pred, proj, branchless);
+                I const pivot_pos = part.first;
+                auto const l_size = pivot_pos - first;
+                auto const r_size = last - (pivot_pos + 1);
+
+                if(l_size < size / 8 || r_size < size / 8)
+                {
+                    if(--bad_allowed == 0)
+                    {
+                        ranges::make_heap(first, last, std::ref(pred), std::ref(proj));
+                        ranges::sort_heap(first, last, std::ref(pred), std::ref(proj));
+                        return;
+                    }
+                    detail::pdqsort_break_patterns(first, pivot_pos);
+                    detail::pdqsort_break_patterns(pivot_pos + 1, last);
+                }
+                else if(part.second &&
+                        detail::pdqsort_partial_insertion_sort(
+                            first, pivot_pos, pred, proj) &&
+                        detail::pdqsort_partial_insertion_sort(
+                            pivot_pos + 1, last, pred, proj))
+                {
+                    // The partition moved nothing and both sides were nearly
+                    // sorted already; now they are sorted.
+                    return;
+                }
+
+                detail::pdqsort_loop(
+                    first, pivot_pos, bad_allowed, leftmost, pred, proj, branchless);
+                first = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+
+        template<typename I, typename C, typename P>
+        void pdqsort(I first, I last, C & pred, P & proj)
+        {
+            if(last - first < 2)
+                return;
+            detail::pdqsort_loop(first,
+                                 last,
+                                 static_cast<int>(detail::log2(last - first)),
+                                 true,
+                                 pred,
+                                 proj,
+                                 pdqsort_branchless<I, C, P>{});
+        }
+
+        template<typename I, typename C, typename P>
+        void sequential_sort(I first, I last, C & pred, P & proj)
+        {
+#if RANGES_SORT_USE_PDQSORT
+            detail::pdqsort(first, last, pred, proj);
+#else
+            detail::introsort(first, last, pred, proj);
+#endif
+        }
+
+        // Below this many elements a parallel sort stops forking new tasks.
+        constexpr std::ptrdiff_t parallel_sort_grain_size()
+        {
+            return 1 << 14;
+        }
+
+        // Parallel quicksort: partition as introsort does and sort both sides
+        // concurrently until either the pieces are small or every thread has
+        // enough to do, then finish each piece with the sequential algorithm.
+        // Each piece is self-contained, so final_insertion_sort can be run on
+        // it in isolation.
+        template<typename I, typename Size, typename C, typename P>
+        void parallel_introsort(I first, I last, Size depth_limit, int fork_depth,
+                                C & pred, P & proj)
+        {
+            if(fork_depth > 0 && depth_limit > 0 &&
+               last - first > detail::parallel_sort_grain_size())
+            {
+                I cut = detail::unguarded_partition(first, last, pred, proj);
+                --depth_limit;
+                --fork_depth;
+                detail::parallel_invoke(
+                    [=, &pred, &proj] {
+                        detail::parallel_introsort(
+                            cut, last, depth_limit, fork_depth, pred, proj);
+                    },
+                    [=, &pred, &proj] {
+                        detail::parallel_introsort(
+                            first, cut, depth_limit, fork_depth, pred, proj);
+                    });
+                return;
+            }
+            detail::sequential_sort(first, last, pred, proj);
+        }
     } // namespace detail
     /// \endcond
 
     /// \addtogroup group-algorithms
     /// @{
 
-    // Introsort: Quicksort to a certain depth, then Heapsort. Insertion
-    // sort below a certain threshold.
+    // Pattern-defeating quicksort: introsort that also detects sorted runs,
+    // handles many duplicates in linear time and partitions arithmetic keys
+    // without branches (see RANGES_SORT_USE_PDQSORT). With
+    // RANGES_SORT_USE_RADIX, large inputs with arithmetic keys ordered by less
+    // are radix sorted instead.
     // TODO Forward iterators, like EoP?
 
     RANGES_FUNC_BEGIN(sort)
@@ -201,12 +665,9 @@ namespace ranges
         I RANGES_FUNC(sort)(I first, S end_, C pred = C{}, P proj = P{})
         {
             I last = ranges::next(first, std::move(end_));
-            if(first != last)
-            {
-                detail::introsort_loop(
-                    first, last, detail::log2(last - first) * 2, pred, proj);
-                detail::final_insertion_sort(first, last, pred, proj);
-            }
+            if(first != last &&
+               !detail::try_radix_sort(first, last - first, nullptr, 0, pred, proj))
+                detail::sequential_sort(first, last, pred, proj);
             return last;
         }
 
@@ -220,6 +681,60 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        /// With a parallel execution policy, \c pred and \c proj may be invoked
+        /// concurrently from several threads.
+        template(typename ExecutionPolicy,
+                 typename I,
+                 typename S,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND sortable<I, C, P> AND
+                random_access_iterator<I> AND sentinel_for<S, I>)
+        I RANGES_FUNC(sort)(ExecutionPolicy &&,
+                            I first,
+                            S end_,
+                            C pred = C{},
+                            P proj = P{})
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(first),
+                               std::move(end_),
+                               std::move(pred),
+                               std::move(proj));
+            I last = ranges::next(first, std::move(end_));
+            if(first != last)
+                detail::parallel_introsort(first,
+                                           last,
+                                           detail::log2(last - first) * 2,
+                                           detail::parallel_fork_depth(),
+                                           pred,
+                                           proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy,
+                 typename Rng,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                sortable<iterator_t<Rng>, C, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(sort)(ExecutionPolicy && policy,
+                          Rng && rng,
+                          C pred = C{},
+                          P proj = P{}) //
+        {
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(sort)
 
     namespace cpp20
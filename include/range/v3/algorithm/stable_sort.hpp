@@ -43,11 +43,15 @@
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
 #include <range/v3/algorithm/merge.hpp>
 #include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/move_iterators.hpp>
 #include <range/v3/iterator/operations.hpp>
@@ -56,6 +60,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -187,6 +192,105 @@ namespace ranges
                                    std::ref(pred),
                                    std::ref(proj));
         }
+
+        // Merge the sorted ranges [first, middle) and [middle, last) by splitting
+        // them, as merge_adaptive does, into two independent merges that run
+        // concurrently. Each half gets its own slice of the buffer; once the
+        // pieces are small (or every thread is busy), merge_adaptive finishes the
+        // job. A null buffer is fine; merge_adaptive then merges in place.
+        template<typename I, typename V, typename C, typename P>
+        void parallel_merge_adaptive(I first, I middle, I last, V * buffer,
+                                     std::ptrdiff_t buffer_size, int fork_depth,
+                                     C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            D len1 = middle - first, len2 = last - middle;
+            if(fork_depth <= 0 || len1 == 0 || len2 == 0 ||
+               len1 + len2 <= detail::parallel_sort_grain_size())
+            {
+                detail::merge_adaptive(first,
+                                       middle,
+                                       last,
+                                       len1,
+                                       len2,
+                                       buffer,
+                                       buffer_size,
+                                       std::ref(pred),
+                                       std::ref(proj));
+                return;
+            }
+            I m1, m2;
+            if(len1 < len2)
+            {
+                m2 = middle + len2 / 2;
+                m1 = upper_bound(
+                    first, middle, invoke(proj, *m2), std::ref(pred), std::ref(proj));
+            }
+            else
+            {
+                m1 = first + len1 / 2;
+                m2 = lower_bound(
+                    middle, last, invoke(proj, *m1), std::ref(pred), std::ref(proj));
+            }
+            I new_middle = rotate(m1, middle, m2).begin();
+            std::ptrdiff_t const half = buffer_size / 2;
+            V * const lower = half == 0 ? nullptr : buffer;
+            V * const upper = buffer_size == half ? nullptr : buffer + half;
+            --fork_depth;
+            detail::parallel_invoke(
+                [=, &pred, &proj] {
+                    detail::parallel_merge_adaptive(
+                        first, m1, new_middle, lower, half, fork_depth, pred, proj);
+                },
+                [=, &pred, &proj] {
+                    detail::parallel_merge_adaptive(new_middle,
+                                                    m2,
+                                                    last,
+                                                    upper,
+                                                    buffer_size - half,
+                                                    fork_depth,
+                                                    pred,
+                                                    proj);
+                });
+        }
+
+        // Parallel merge sort: sort both halves concurrently, each with its own
+        // slice of the buffer, then merge them with parallel_merge_adaptive.
+        template<typename I, typename V, typename C, typename P>
+        void parallel_stable_sort(I first, I last, V * buffer,
+                                  std::ptrdiff_t buffer_size, int fork_depth,
+                                  C & pred, P & proj)
+        {
+            if(fork_depth <= 0 || last - first <= detail::parallel_sort_grain_size())
+            {
+                if(buffer == nullptr)
+                    detail::inplace_stable_sort(first, last, pred, proj);
+                else
+                    detail::stable_sort_adaptive(
+                        first, last, buffer, buffer_size, pred, proj);
+                return;
+            }
+            I middle = first + (last - first) / 2;
+            std::ptrdiff_t const half = buffer_size / 2;
+            V * const lower = half == 0 ? nullptr : buffer;
+            V * const upper = buffer_size == half ? nullptr : buffer + half;
+            detail::parallel_invoke(
+                [=, &pred, &proj] {
+                    detail::parallel_stable_sort(
+                        first, middle, lower, half, fork_depth - 1, pred, proj);
+                },
+                [=, &pred, &proj] {
+                    detail::parallel_stable_sort(middle,
+                                                 last,
+                                                 upper,
+                                                 buffer_size - half,
+                                                 fork_depth - 1,
+                                                 pred,
+                                                 proj);
+                });
+            detail::parallel_merge_adaptive(
+                first, middle, last, buffer, buffer_size, fork_depth, pred, proj);
+        }
     } // namespace detail
     /// \endcond
 
@@ -206,6 +310,8 @@ namespace ranges
             auto buf =
                 len > 256 ? detail::get_temporary_buffer<V>(len) : detail::value_init{};
             std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            if(detail::try_radix_sort(first, len, buf.first, buf.second, pred, proj))
+                return last;
             if(buf.first == nullptr)
                 detail::inplace_stable_sort(first, last, pred, proj);
             else
@@ -224,6 +330,66 @@ namespace ranges
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
 
+        /// \overload
+        /// With a parallel execution policy, \c pred and \c proj may be invoked
+        /// concurrently from several threads.
+        template(typename ExecutionPolicy,
+                 typename I,
+                 typename S,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND sortable<I, C, P> AND
+                random_access_iterator<I> AND sentinel_for<S, I>)
+        I RANGES_FUNC(stable_sort)(ExecutionPolicy &&,
+                                   I first,
+                                   S end_,
+                                   C pred = C{},
+                                   P proj = P{})
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(first),
+                               std::move(end_),
+                               std::move(pred),
+                               std::move(proj));
+            I last = ranges::next(first, end_);
+            using D = iter_difference_t<I>;
+            using V = iter_value_t<I>;
+            D len = last - first;
+            auto buf =
+                len > 256 ? detail::get_temporary_buffer<V>(len) : detail::value_init{};
+            std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            detail::parallel_stable_sort(first,
+                                         last,
+                                         buf.first,
+                                         buf.second,
+                                         detail::parallel_fork_depth(),
+                                         pred,
+                                         proj);
+            return last;
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy,
+                 typename Rng,
+                 typename C = less,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                sortable<iterator_t<Rng>, C, P> AND random_access_range<Rng>)
+        borrowed_iterator_t<Rng> //
+        RANGES_FUNC(stable_sort)(ExecutionPolicy && policy,
+                                 Rng && rng,
+                                 C pred = C{},
+                                 P proj = P{}) //
+        {
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           begin(rng),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
     RANGES_FUNC_END(stable_sort)
 
     namespace cpp20
@@ -23,12 +23,14 @@
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/iterator/unreachable_sentinel.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -210,6 +212,157 @@ namespace ranges
                            std::move(proj1));
         }
 
+        // Parallel variants
+        /// \overload
+        /// With a parallel execution policy, the range is split into pieces
+        /// that are transformed concurrently, so \c fun and \c proj may be
+        /// invoked from several threads at once.
+        template(typename ExecutionPolicy,
+                 typename I,
+                 typename S,
+                 typename O,
+                 typename F,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                random_access_iterator<I> AND sized_sentinel_for<S, I> AND
+                random_access_iterator<O> AND copy_constructible<F> AND
+                indirectly_writable<O, indirect_result_t<F &, projected<I, P>>>)
+        unary_transform_result<I, O> //
+        RANGES_FUNC(transform)(
+            ExecutionPolicy &&, I first, S last, O out, F fun, P proj = P{}) //
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(first),
+                               std::move(last),
+                               std::move(out),
+                               std::move(fun),
+                               std::move(proj));
+            auto const n = last - first;
+            detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+                O o = out + lo;
+                for(I i = first + lo, e = first + hi; i != e; ++i, ++o)
+                    *o = invoke(fun, invoke(proj, *i));
+            });
+            return {first + n, out + n};
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy,
+                 typename Rng,
+                 typename O,
+                 typename F,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND random_access_range<Rng> AND
+                sized_range<Rng> AND random_access_iterator<O> AND
+                copy_constructible<F> AND
+                indirectly_writable<O, indirect_result_t<F &, projected<iterator_t<Rng>, P>>>)
+        unary_transform_result<borrowed_iterator_t<Rng>, O> //
+        RANGES_FUNC(transform)(
+            ExecutionPolicy && policy, Rng && rng, O out, F fun, P proj = P{}) //
+        {
+            auto first = begin(rng);
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           first,
+                           first + ranges::distance(rng),
+                           std::move(out),
+                           std::move(fun),
+                           std::move(proj));
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy,
+                 typename I0,
+                 typename S0,
+                 typename I1,
+                 typename S1,
+                 typename O,
+                 typename F,
+                 typename P0 = identity,
+                 typename P1 = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                random_access_iterator<I0> AND sized_sentinel_for<S0, I0> AND
+                random_access_iterator<I1> AND sized_sentinel_for<S1, I1> AND
+                random_access_iterator<O> AND copy_constructible<F> AND
+                indirectly_writable<
+                    O,
+                    indirect_result_t<F &, projected<I0, P0>, projected<I1, P1>>>)
+        binary_transform_result<I0, I1, O> //
+        RANGES_FUNC(transform)(ExecutionPolicy &&,
+                               I0 begin0,
+                               S0 end0,
+                               I1 begin1,
+                               S1 end1,
+                               O out,
+                               F fun,
+                               P0 proj0 = P0{},
+                               P1 proj1 = P1{}) //
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(begin0),
+                               std::move(end0),
+                               std::move(begin1),
+                               std::move(end1),
+                               std::move(out),
+                               std::move(fun),
+                               std::move(proj0),
+                               std::move(proj1));
+            auto const n0 = end0 - begin0;
+            auto const n1 = end1 - begin1;
+            std::ptrdiff_t const n = n0 < n1 ? n0 : n1;
+            detail::parallel_for(n, [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+                I1 i1 = begin1 + lo;
+                O o = out + lo;
+                for(I0 i0 = begin0 + lo, e = begin0 + hi; i0 != e; ++i0, ++i1, ++o)
+                    *o = invoke(fun, invoke(proj0, *i0), invoke(proj1, *i1));
+            });
+            return {begin0 + n, begin1 + n, out + n};
+        }
+
+        /// \overload
+        template(typename ExecutionPolicy,
+                 typename Rng0,
+                 typename Rng1,
+                 typename O,
+                 typename F,
+                 typename P0 = identity,
+                 typename P1 = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                random_access_range<Rng0> AND sized_range<Rng0> AND
+                random_access_range<Rng1> AND sized_range<Rng1> AND
+                random_access_iterator<O> AND copy_constructible<F> AND
+                indirectly_writable<
+                    O,
+                    indirect_result_t<F &,
+                                      projected<iterator_t<Rng0>, P0>,
+                                      projected<iterator_t<Rng1>, P1>>>)
+        binary_transform_result<borrowed_iterator_t<Rng0>,
+                                borrowed_iterator_t<Rng1>,
+                                O> //
+        RANGES_FUNC(transform)(ExecutionPolicy && policy,
+                               Rng0 && rng0,
+                               Rng1 && rng1,
+                               O out,
+                               F fun,
+                               P0 proj0 = P0{},
+                               P1 proj1 = P1{}) //
+        {
+            auto first0 = begin(rng0);
+            auto first1 = begin(rng1);
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           first0,
+                           first0 + ranges::distance(rng0),
+                           first1,
+                           first1 + ranges::distance(rng1),
+                           std::move(out),
+                           std::move(fun),
+                           std::move(proj0),
+                           std::move(proj1));
+        }
+
     RANGES_FUNC_END(transform)
 
     namespace cpp20
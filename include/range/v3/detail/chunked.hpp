@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_CHUNKED_HPP
+#define RANGES_V3_DETAIL_CHUNKED_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/range_access.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Ranges whose every iterator operation is an indirect call (any_view)
+        // may provide a private member, reachable through range_access,
+        //
+        //     template<typename F>
+        //     iterator_t<Rng> for_each_chunked(F & f);
+        //
+        // that invokes f on each element in turn and returns the end iterator,
+        // spreading the cost of the indirection over blocks of elements.
+        // Algorithms that visit every element of a range once check for it
+        // with chunked_range_v, so it must read each element no earlier than
+        // iterating would, unless reading ahead is what the view is for, as
+        // with views::par.
+        //
+        // They may also provide
+        //
+        //     template<typename F>
+        //     iterator_t<Rng> for_each_buffered(F & f);
+        //
+        // which may read blocks of elements before f sees the first of them.
+        // Only ranges::for_each_buffered, which asks for that, checks for it
+        // with buffered_range_v.
+        struct chunked_probe_fn
+        {
+            template<typename T>
+            void operator()(T &&) const;
+        };
+
+        template<typename Rng, typename = void>
+        struct chunked_range_ : std::false_type
+        {};
+
+        template<typename Rng>
+        struct chunked_range_<Rng, meta::void_<decltype(range_access::for_each_chunked(
+                                       std::declval<Rng &>(),
+                                       std::declval<chunked_probe_fn &>()))>>
+          : std::true_type
+        {};
+
+        template<typename Rng>
+        RANGES_INLINE_VAR constexpr bool chunked_range_v =
+            chunked_range_<meta::_t<std::remove_reference<Rng>>>::value;
+
+        template<typename Rng, typename = void>
+        struct buffered_range_ : std::false_type
+        {};
+
+        template<typename Rng>
+        struct buffered_range_<Rng, meta::void_<decltype(range_access::for_each_buffered(
+                                        std::declval<Rng &>(),
+                                        std::declval<chunked_probe_fn &>()))>>
+          : std::true_type
+        {};
+
+        template<typename Rng>
+        RANGES_INLINE_VAR constexpr bool buffered_range_v =
+            buffered_range_<meta::_t<std::remove_reference<Rng>>>::value;
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
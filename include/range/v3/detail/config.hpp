@@ -84,6 +84,14 @@ namespace ranges
 #endif // NDEBUG
 #endif // RANGES_EXPECT
 
+#ifndef RANGES_PREFETCH
+#if defined(__clang__) || defined(__GNUC__)
+#define RANGES_PREFETCH(PTR) __builtin_prefetch(PTR)
+#else
+#define RANGES_PREFETCH(PTR) static_cast<void>(PTR)
+#endif
+#endif // RANGES_PREFETCH
+
 #ifndef RANGES_ENSURE_MSG
 #if defined(NDEBUG)
 #define RANGES_ENSURE_MSG(COND, MSG)                             \
@@ -749,6 +757,28 @@ namespace ranges
 #endif
 #endif
 
+// RANGES_IS_CONSTANT_EVALUATED() is true during constant evaluation. Without
+// compiler support it is always true, so that code guarded by
+// !RANGES_IS_CONSTANT_EVALUATED() (typically a call to memmove or memset) is
+// never taken.
+#ifndef RANGES_IS_CONSTANT_EVALUATED
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define RANGES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(RANGES_IS_CONSTANT_EVALUATED) && defined(__GNUC__) && \
+    !defined(__clang__) && __GNUC__ >= 9
+#define RANGES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(RANGES_IS_CONSTANT_EVALUATED) && defined(_MSC_VER) && _MSC_VER >= 1925
+#define RANGES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#ifndef RANGES_IS_CONSTANT_EVALUATED
+#define RANGES_IS_CONSTANT_EVALUATED() true
+#endif
+#endif
+
 #ifndef RANGES_EMPTY_BASES
 #ifdef _MSC_VER
 #define RANGES_EMPTY_BASES __declspec(empty_bases)
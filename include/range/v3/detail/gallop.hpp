@@ -0,0 +1,202 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_GALLOP_HPP
+#define RANGES_V3_DETAIL_GALLOP_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // How many elements a gallop steps over one at a time before it starts
+        // to search: short skips are cheaper to walk than to search.
+        RANGES_INLINE_VAR constexpr int gallop_linear_steps = 8;
+
+        template<typename I, typename S, typename V, typename C, typename P>
+        I gallop_(I first, S last, V const & val, C & pred, P & proj, std::false_type)
+        {
+            for(; first != last && invoke(pred, invoke(proj, *first), val); ++first)
+                ;
+            return first;
+        }
+
+        template<typename I, typename S, typename V, typename C, typename P>
+        I gallop_(I first, S last, V const & val, C & pred, P & proj, std::true_type)
+        {
+            for(int i = 0; i != gallop_linear_steps; ++i, ++first)
+                if(first == last || !invoke(pred, invoke(proj, *first), val))
+                    return first;
+
+            // Find the position past a run of elements less than val in
+            // [first + lo, first + hi), doubling hi...
+            auto const n = last - first;
+            iter_difference_t<I> lo = 0, hi = 1;
+            while(hi <= n && invoke(pred, invoke(proj, first[hi - 1]), val))
+            {
+                lo = hi;
+                hi = hi > n - hi ? n + 1 : hi * 2;
+            }
+            // ...and then by binary search in that interval.
+            first += lo;
+            for(auto d = (hi <= n ? hi - 1 : n) - lo; d != 0;)
+            {
+                auto const half = d / 2;
+                auto const middle = first + half;
+                if(invoke(pred, invoke(proj, *middle), val))
+                {
+                    first = middle + 1;
+                    d -= half + 1;
+                }
+                else
+                    d = half;
+            }
+            return first;
+        }
+
+        // Returns the first iterator in [first, last) whose projection does
+        // not compare less than val, the elements before it being those that
+        // do. With random access, the first few elements are stepped over one
+        // at a time and the rest are galloped over, so that a long skip of d
+        // elements costs O(log d) comparisons and a short one no more than a
+        // linear scan.
+        template<typename I, typename S, typename V, typename C, typename P>
+        I gallop(I first, S last, V const & val, C & pred, P & proj)
+        {
+            return detail::gallop_(
+                std::move(first),
+                std::move(last),
+                val,
+                pred,
+                proj,
+                meta::bool_<random_access_iterator<I> && sized_sentinel_for<S, I>>{});
+        }
+
+        template<typename I, typename S, typename V, typename C, typename P>
+        I gallop_past_(I first, S last, V const & val, C & pred, P & proj,
+                       std::ptrdiff_t & skipped, std::false_type)
+        {
+            std::ptrdiff_t d = 1;
+            for(++first; first != last && invoke(pred, invoke(proj, *first), val);
+                ++first, ++d)
+                ;
+            skipped = d;
+            return first;
+        }
+
+        template<typename I, typename S, typename V, typename C, typename P>
+        I gallop_past_(I first, S last, V const & val, C & pred, P & proj,
+                       std::ptrdiff_t & skipped, std::true_type)
+        {
+            // first[lo] is less than val, and first[hi] is not or is last.
+            auto const n = last - first;
+            I const start = first;
+            iter_difference_t<I> lo = 0, hi = 1;
+            while(hi < n && invoke(pred, invoke(proj, first[hi]), val))
+            {
+                lo = hi;
+                hi = hi < (n - 1) / 2 ? 2 * hi + 1 : n;
+            }
+            first += lo + 1;
+            for(auto d = hi - lo - 1; d != 0;)
+            {
+                auto const half = d / 2;
+                auto const middle = first + half;
+                if(invoke(pred, invoke(proj, *middle), val))
+                {
+                    first = middle + 1;
+                    d -= half + 1;
+                }
+                else
+                    d = half;
+            }
+            skipped = static_cast<std::ptrdiff_t>(first - start);
+            return first;
+        }
+
+        // The length of the run of wins by one input after which a set
+        // algorithm first gallops over it, as TimSort's MIN_GALLOP.
+        RANGES_INLINE_VAR constexpr int gallop_min_run = 7;
+
+        // When the set algorithms gallop, after TimSort's min_gallop. They
+        // compare one element at a time, like a merge, until one input has won
+        // threshold comparisons in a row, and then skip the rest of its run by
+        // exponential and binary search. The threshold falls after a skip of
+        // at least gallop_min_run elements and rises after a shorter one, so
+        // that inputs whose runs are short are compared as by a merge.
+        struct gallop_mode
+        {
+        private:
+            int threshold_ = gallop_min_run;
+            int run_ = 0;
+            int side_ = 0;
+
+        public:
+            // Records a win by input side, and returns whether to skip over its
+            // run with skip.
+            bool win(int side) noexcept
+            {
+                if(side != side_)
+                {
+                    side_ = side;
+                    run_ = 0;
+                }
+                return ++run_ >= threshold_;
+            }
+            // Records a comparison that neither input won.
+            void tie() noexcept
+            {
+                run_ = 0;
+            }
+            // Returns the first iterator after first whose projection does not
+            // compare less than val, given that that of first does. The
+            // element it returns, unless it is last, is known not to be less
+            // than val without comparing it again.
+            template<typename I, typename S, typename V, typename C, typename P>
+            I skip(I first, S last, V const & val, C & pred, P & proj)
+            {
+                std::ptrdiff_t skipped = 0;
+                first = detail::gallop_past_(
+                    std::move(first),
+                    std::move(last),
+                    val,
+                    pred,
+                    proj,
+                    skipped,
+                    meta::bool_<random_access_iterator<I> && sized_sentinel_for<S, I>>{});
+                if(skipped >= gallop_min_run)
+                    threshold_ -= threshold_ > 1;
+                else
+                    threshold_ += 2;
+                run_ = 0;
+                return first;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,146 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_LOSER_TREE_HPP
+#define RANGES_V3_DETAIL_LOSER_TREE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // A tournament over k sorted runs, each an iterator and a sentinel.
+        // Every internal node holds the run that lost the match played there,
+        // and the overall winner, whose front element is the least of all the
+        // fronts, is kept apart. After the winner's front is consumed, only the
+        // matches on the path from its leaf to the root are replayed, so each
+        // element costs O(log k) comparisons. Equal elements come out in the
+        // order of their runs, so the merge is stable.
+        //
+        // The runs are numbered from 0 to k-1. Leaf i is node k+i, and the
+        // parent of node n is node n/2, which gives k-1 internal nodes for any
+        // k; node 0 holds the winner.
+        template<typename I, typename S>
+        struct loser_tree
+        {
+            struct run
+            {
+                I it;
+                S end;
+            };
+
+        private:
+            std::vector<run> runs_;
+            std::vector<std::size_t> nodes_;
+            std::size_t active_ = 0;
+
+            // Whether the front of run a comes out before the front of run b.
+            template<typename C, typename P>
+            bool beats_(std::size_t a, std::size_t b, C & pred, P & proj) const
+            {
+                if(runs_[a].it == runs_[a].end)
+                    return false;
+                if(runs_[b].it == runs_[b].end)
+                    return true;
+                return a < b ? !invoke(pred, invoke(proj, *runs_[b].it),
+                                       invoke(proj, *runs_[a].it))
+                             : invoke(pred, invoke(proj, *runs_[a].it),
+                                      invoke(proj, *runs_[b].it));
+            }
+
+        public:
+            loser_tree() = default;
+
+            void reserve(std::size_t k)
+            {
+                runs_.reserve(k);
+            }
+            void push_back(I it, S end)
+            {
+                if(it != end)
+                    ++active_;
+                runs_.push_back(run{std::move(it), std::move(end)});
+            }
+
+            // Plays every match, once all the runs have been added.
+            template<typename C, typename P>
+            void build(C & pred, P & proj)
+            {
+                std::size_t const k = runs_.size();
+                nodes_.assign(k, 0);
+                if(k <= 1)
+                    return;
+                // The winners of the matches below each internal node.
+                std::vector<std::size_t> winners(k);
+                for(std::size_t n = k - 1; n != 0; --n)
+                {
+                    std::size_t const l = 2 * n, r = 2 * n + 1;
+                    std::size_t a = l < k ? winners[l] : l - k;
+                    std::size_t b = r < k ? winners[r] : r - k;
+                    if(beats_(b, a, pred, proj))
+                        std::swap(a, b);
+                    winners[n] = a;
+                    nodes_[n] = b;
+                }
+                nodes_[0] = winners[1];
+            }
+
+            // The number of runs that are not yet exhausted.
+            std::size_t active() const
+            {
+                return active_;
+            }
+            // The run whose front is the least of all the fronts.
+            run & top()
+            {
+                return runs_[nodes_[0]];
+            }
+            run const & top() const
+            {
+                return runs_[nodes_[0]];
+            }
+
+            // Consumes the front of the winning run and replays its matches.
+            template<typename C, typename P>
+            void pop(C & pred, P & proj)
+            {
+                std::size_t const k = runs_.size();
+                std::size_t w = nodes_[0];
+                run & r = runs_[w];
+                if(++r.it == r.end)
+                    --active_;
+                for(std::size_t n = (k + w) / 2; n != 0; n /= 2)
+                {
+                    if(beats_(nodes_[n], w, pred, proj))
+                        std::swap(nodes_[n], w);
+                }
+                nodes_[0] = w;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -102,6 +102,21 @@ namespace ranges
         (
             return rng.end_adaptor()
         )
+        template<typename Rng, typename F>
+        static constexpr auto CPP_auto_fun(for_each_chunked)(Rng &rng, F &f)
+        (
+            return rng.for_each_chunked(f)
+        )
+        template<typename Rng, typename F>
+        static constexpr auto CPP_auto_fun(for_each_buffered)(Rng &rng, F &f)
+        (
+            return rng.for_each_buffered(f)
+        )
+        template<typename Rng, typename F>
+        static constexpr auto CPP_auto_fun(for_each_segment)(Rng &rng, F &f)
+        (
+            return rng.for_each_segment(f)
+        )
 
         template<typename Cur>
         static constexpr auto CPP_auto_fun(read)(Cur const &pos)
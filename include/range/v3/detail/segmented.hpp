@@ -0,0 +1,96 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_SEGMENTED_HPP
+#define RANGES_V3_DETAIL_SEGMENTED_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/traits.hpp>
+
+#include <range/v3/detail/range_access.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Ranges whose elements are laid out in segments that are ranges of
+        // their own (join_view, concat_view, or a container of fixed-size
+        // blocks) may provide a private member, reachable through range_access,
+        //
+        //     template<typename F>
+        //     iterator_t<Rng> for_each_segment(F & f);
+        //
+        // that invokes f(first, last) on the iterator and sentinel of each
+        // segment in turn. f returns the iterator where it stopped; if that is
+        // not last, for_each_segment stops as well and returns the iterator of
+        // the range at that position, and otherwise it goes on to the next
+        // segment and eventually returns the end iterator. Algorithms check for
+        // it with segmented_range_v and run their inner loop on each segment,
+        // where it sees the iterators of the underlying ranges (pointers, for
+        // a join of vectors) rather than those of the view.
+        struct segmented_probe_fn
+        {
+            template<typename I, typename S>
+            I operator()(I, S) const;
+        };
+
+        template<typename Rng, typename = void>
+        struct segmented_range_ : std::false_type
+        {};
+
+        template<typename Rng>
+        struct segmented_range_<Rng, meta::void_<decltype(range_access::for_each_segment(
+                                         std::declval<Rng &>(),
+                                         std::declval<segmented_probe_fn &>()))>>
+          : std::true_type
+        {};
+
+        template<typename Rng>
+        RANGES_INLINE_VAR constexpr bool segmented_range_v =
+            segmented_range_<meta::_t<std::remove_reference<Rng>>>::value;
+
+        template<typename Rng, typename F>
+        iterator_t<Rng> for_each_segment_(Rng & rng, F & f, std::true_type)
+        {
+            return range_access::for_each_segment(rng, f);
+        }
+        template<typename Rng, typename F>
+        iterator_t<Rng> for_each_segment_(Rng & rng, F & f, std::false_type)
+        {
+            return f(ranges::begin(rng), ranges::end(rng));
+        }
+
+        // Visits the segments of rng, or rng as a whole if it has none. Segmented
+        // ranges use it on the ranges they are made of, so that segments of
+        // segments are visited too.
+        template<typename Rng, typename F>
+        iterator_t<Rng> for_each_segment(Rng & rng, F & f)
+        {
+            return detail::for_each_segment_(
+                rng, f, meta::bool_<segmented_range_v<Rng>>{});
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,528 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_SIMD_HPP
+#define RANGES_V3_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+// Define RANGES_USE_SIMD to 0 to keep find, count, equal, mismatch and
+// lexicographical_compare from using vector instructions.
+#ifndef RANGES_USE_SIMD
+#define RANGES_USE_SIMD 1
+#endif
+
+#if RANGES_USE_SIMD && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RANGES_SIMD_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#if defined(__AVX2__)
+#define RANGES_SIMD_AVX2 1
+#include <immintrin.h>
+#elif(defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    !defined(__INTEL_COMPILER)
+// AVX2 versions of the kernels are compiled with a target attribute and chosen
+// at run time, on the first call, if the CPU supports them.
+#define RANGES_SIMD_AVX2 1
+#define RANGES_SIMD_AVX2_DISPATCH 1
+#include <immintrin.h>
+#endif
+#endif
+
+// The dispatchers are kept out of line: inlined into a caller whose range is
+// known to be short, GCC warns about their (unreachable) vector loads.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RANGES_SIMD_NOINLINE __declspec(noinline)
+#else
+#define RANGES_SIMD_NOINLINE __attribute__((noinline))
+#endif
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Integral types whose values compare equal exactly when their object
+        // representations do.
+        template<typename T>
+        RANGES_INLINE_VAR constexpr bool is_simd_element_ =
+            std::is_integral<T>::value &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+        template<typename I>
+        RANGES_INLINE_VAR constexpr bool is_simd_iterator_ =
+            is_simd_element_<iter_value_t<I>> &&
+            (RANGES_IS_SAME(iter_reference_t<I>, iter_value_t<I> &) ||
+             RANGES_IS_SAME(iter_reference_t<I>, iter_value_t<I> const &));
+
+        // Whether find(first, last, val, proj) and count can compare the
+        // elements of [I, S) with a V by comparing their bytes.
+        template<typename I, typename S, typename V, typename P,
+                 bool = contiguous_iterator<I> && sized_sentinel_for<S, I>>
+        struct is_simd_findable_ : std::false_type
+        {};
+
+        template<typename I, typename S, typename V, typename P>
+        struct is_simd_findable_<I, S, V, P, true>
+          : meta::bool_<is_simd_iterator_<I> && std::is_integral<V>::value &&
+                        RANGES_IS_SAME(P, identity)>
+        {};
+
+        template<typename I, typename S, typename V, typename P>
+        using is_simd_findable = meta::bool_<is_simd_findable_<I, S, V, P>::value>;
+
+        // Whether comparing the elements of [I0, S0) and [I1, S1) with C is
+        // the same as comparing their bytes (C is equal_to) or comparing them
+        // after finding the first bytes that differ (C is less).
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1,
+                 bool = contiguous_iterator<I0> && sized_sentinel_for<S0, I0> &&
+                        contiguous_iterator<I1> && sized_sentinel_for<S1, I1>>
+        struct is_simd_comparable_ : std::false_type
+        {};
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        struct is_simd_comparable_<I0, S0, I1, S1, C, P0, P1, true>
+          : meta::bool_<RANGES_IS_SAME(iter_value_t<I0>, iter_value_t<I1>) &&
+                        is_simd_iterator_<I0> && is_simd_iterator_<I1> &&
+                        (RANGES_IS_SAME(C, ranges::equal_to) ||
+                         RANGES_IS_SAME(C, ranges::less)) &&
+                        RANGES_IS_SAME(P0, identity) && RANGES_IS_SAME(P1, identity)>
+        {};
+
+        template<typename I0, typename S0, typename I1, typename S1, typename C,
+                 typename P0, typename P1>
+        using is_simd_comparable =
+            meta::bool_<is_simd_comparable_<I0, S0, I1, S1, C, P0, P1>::value>;
+
+        // If some T compares equal to val, stores that T in out and returns
+        // true. Such a T, if any, is the one with the same value modulo 2^N,
+        // which is what the conversion gives.
+        template<typename T, typename V>
+        bool simd_value(V const & val, T & out) noexcept
+        {
+            out = static_cast<T>(val);
+            return out == val;
+        }
+
+#ifdef RANGES_SIMD_SSE2
+        inline unsigned simd_ctz(unsigned mask) noexcept
+        {
+#ifdef _MSC_VER
+            unsigned long i;
+            _BitScanForward(&i, mask);
+            return static_cast<unsigned>(i);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+
+        template<typename T>
+        using simd_uint_t = meta::if_c<
+            sizeof(T) == 1, std::uint8_t,
+            meta::if_c<sizeof(T) == 2, std::uint16_t,
+                       meta::if_c<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+        template<typename T>
+        simd_uint_t<T> simd_bits(T val) noexcept
+        {
+            simd_uint_t<T> bits;
+            std::memcpy(&bits, &val, sizeof(T));
+            return bits;
+        }
+
+        // SSE2
+        inline __m128i sse2_set1(std::uint8_t v) noexcept
+        {
+            return _mm_set1_epi8(static_cast<char>(v));
+        }
+        inline __m128i sse2_set1(std::uint16_t v) noexcept
+        {
+            return _mm_set1_epi16(static_cast<short>(v));
+        }
+        inline __m128i sse2_set1(std::uint32_t v) noexcept
+        {
+            return _mm_set1_epi32(static_cast<int>(v));
+        }
+        inline __m128i sse2_set1(std::uint64_t v) noexcept
+        {
+            return _mm_set_epi32(static_cast<int>(v >> 32),
+                                 static_cast<int>(v),
+                                 static_cast<int>(v >> 32),
+                                 static_cast<int>(v));
+        }
+        inline __m128i sse2_cmpeq(__m128i a, __m128i b, meta::size_t<1>) noexcept
+        {
+            return _mm_cmpeq_epi8(a, b);
+        }
+        inline __m128i sse2_cmpeq(__m128i a, __m128i b, meta::size_t<2>) noexcept
+        {
+            return _mm_cmpeq_epi16(a, b);
+        }
+        inline __m128i sse2_cmpeq(__m128i a, __m128i b, meta::size_t<4>) noexcept
+        {
+            return _mm_cmpeq_epi32(a, b);
+        }
+        inline __m128i sse2_cmpeq(__m128i a, __m128i b, meta::size_t<8>) noexcept
+        {
+            __m128i const eq = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        inline __m128i sse2_sub(__m128i a, __m128i b, meta::size_t<1>) noexcept
+        {
+            return _mm_sub_epi8(a, b);
+        }
+        inline __m128i sse2_sub(__m128i a, __m128i b, meta::size_t<2>) noexcept
+        {
+            return _mm_sub_epi16(a, b);
+        }
+        inline __m128i sse2_sub(__m128i a, __m128i b, meta::size_t<4>) noexcept
+        {
+            return _mm_sub_epi32(a, b);
+        }
+        inline __m128i sse2_sub(__m128i a, __m128i b, meta::size_t<8>) noexcept
+        {
+            return _mm_sub_epi64(a, b);
+        }
+
+        template<typename T>
+        std::size_t sse2_find(T const * p, std::size_t n, T val) noexcept
+        {
+            using W = meta::size_t<sizeof(T)>;
+            constexpr std::size_t lanes = 16 / sizeof(T);
+            __m128i const v = detail::sse2_set1(detail::simd_bits(val));
+            std::size_t i = 0;
+            for(; i + lanes <= n; i += lanes)
+            {
+                __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+                if(unsigned const m = static_cast<unsigned>(
+                       _mm_movemask_epi8(detail::sse2_cmpeq(x, v, W{}))))
+                    return i + detail::simd_ctz(m) / sizeof(T);
+            }
+            for(; i != n; ++i)
+                if(p[i] == val)
+                    break;
+            return i;
+        }
+
+        // Counts in lanes as wide as T, in runs short enough that no lane
+        // can overflow.
+        template<typename T>
+        std::size_t sse2_count(T const * p, std::size_t n, T val) noexcept
+        {
+            using W = meta::size_t<sizeof(T)>;
+            using U = simd_uint_t<T>;
+            constexpr std::size_t lanes = 16 / sizeof(T);
+            constexpr std::size_t run =
+                sizeof(T) == 1 ? 255 : sizeof(T) == 2 ? 65535 : std::size_t(1) << 30;
+            __m128i const v = detail::sse2_set1(detail::simd_bits(val));
+            std::size_t total = 0, i = 0;
+            while(i + lanes <= n)
+            {
+                __m128i acc = _mm_setzero_si128();
+                for(std::size_t k = 0; k != run && i + lanes <= n; ++k, i += lanes)
+                {
+                    __m128i const x =
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+                    acc = detail::sse2_sub(acc, detail::sse2_cmpeq(x, v, W{}), W{});
+                }
+                U counts[lanes];
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(counts), acc);
+                for(U c : counts)
+                    total += c;
+            }
+            for(; i != n; ++i)
+                total += p[i] == val;
+            return total;
+        }
+
+        // The offset of the first byte that differs, or n.
+        inline std::size_t sse2_mismatch_bytes(unsigned char const * a,
+                                               unsigned char const * b,
+                                               std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for(; i + 16 <= n; i += 16)
+            {
+                __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+                __m128i const y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+                unsigned const m =
+                    static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+                if(m != 0xFFFFu)
+                    return i + detail::simd_ctz(~m);
+            }
+            for(; i != n; ++i)
+                if(a[i] != b[i])
+                    break;
+            return i;
+        }
+
+#ifdef RANGES_SIMD_AVX2
+#ifdef RANGES_SIMD_AVX2_DISPATCH
+#define RANGES_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+        inline bool simd_has_avx2() noexcept
+        {
+            static bool const has = [] {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return has;
+        }
+#else
+#define RANGES_SIMD_TARGET_AVX2
+        inline constexpr bool simd_has_avx2() noexcept
+        {
+            return true;
+        }
+#endif
+
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_set1(std::uint8_t v) noexcept
+        {
+            return _mm256_set1_epi8(static_cast<char>(v));
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_set1(std::uint16_t v) noexcept
+        {
+            return _mm256_set1_epi16(static_cast<short>(v));
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_set1(std::uint32_t v) noexcept
+        {
+            return _mm256_set1_epi32(static_cast<int>(v));
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_set1(std::uint64_t v) noexcept
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(v));
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_cmpeq(__m256i a, __m256i b,
+                                                          meta::size_t<1>) noexcept
+        {
+            return _mm256_cmpeq_epi8(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_cmpeq(__m256i a, __m256i b,
+                                                          meta::size_t<2>) noexcept
+        {
+            return _mm256_cmpeq_epi16(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_cmpeq(__m256i a, __m256i b,
+                                                          meta::size_t<4>) noexcept
+        {
+            return _mm256_cmpeq_epi32(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_cmpeq(__m256i a, __m256i b,
+                                                          meta::size_t<8>) noexcept
+        {
+            return _mm256_cmpeq_epi64(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_sub(__m256i a, __m256i b,
+                                                        meta::size_t<1>) noexcept
+        {
+            return _mm256_sub_epi8(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_sub(__m256i a, __m256i b,
+                                                        meta::size_t<2>) noexcept
+        {
+            return _mm256_sub_epi16(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_sub(__m256i a, __m256i b,
+                                                        meta::size_t<4>) noexcept
+        {
+            return _mm256_sub_epi32(a, b);
+        }
+        RANGES_SIMD_TARGET_AVX2 inline __m256i avx2_sub(__m256i a, __m256i b,
+                                                        meta::size_t<8>) noexcept
+        {
+            return _mm256_sub_epi64(a, b);
+        }
+
+        // Checks two vectors per iteration, which keeps both load ports busy.
+        template<typename T>
+        RANGES_SIMD_TARGET_AVX2 std::size_t avx2_find(T const * p, std::size_t n,
+                                                      T val) noexcept
+        {
+            using W = meta::size_t<sizeof(T)>;
+            constexpr std::size_t lanes = 32 / sizeof(T);
+            __m256i const v = detail::avx2_set1(detail::simd_bits(val));
+            std::size_t i = 0;
+            for(; i + 2 * lanes <= n; i += 2 * lanes)
+            {
+                __m256i const x0 =
+                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                __m256i const x1 =
+                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i + lanes));
+                __m256i const e0 = detail::avx2_cmpeq(x0, v, W{});
+                __m256i const e1 = detail::avx2_cmpeq(x1, v, W{});
+                if(!_mm256_testz_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e0, e1)))
+                {
+                    if(unsigned const m = static_cast<unsigned>(_mm256_movemask_epi8(e0)))
+                        return i + detail::simd_ctz(m) / sizeof(T);
+                    unsigned const m = static_cast<unsigned>(_mm256_movemask_epi8(e1));
+                    return i + lanes + detail::simd_ctz(m) / sizeof(T);
+                }
+            }
+            for(; i + lanes <= n; i += lanes)
+            {
+                __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                if(unsigned const m = static_cast<unsigned>(
+                       _mm256_movemask_epi8(detail::avx2_cmpeq(x, v, W{}))))
+                    return i + detail::simd_ctz(m) / sizeof(T);
+            }
+            for(; i != n; ++i)
+                if(p[i] == val)
+                    break;
+            return i;
+        }
+
+        template<typename T>
+        RANGES_SIMD_TARGET_AVX2 std::size_t avx2_count(T const * p, std::size_t n,
+                                                       T val) noexcept
+        {
+            using W = meta::size_t<sizeof(T)>;
+            using U = simd_uint_t<T>;
+            constexpr std::size_t lanes = 32 / sizeof(T);
+            constexpr std::size_t run =
+                sizeof(T) == 1 ? 255 : sizeof(T) == 2 ? 65535 : std::size_t(1) << 30;
+            __m256i const v = detail::avx2_set1(detail::simd_bits(val));
+            std::size_t total = 0, i = 0;
+            while(i + lanes <= n)
+            {
+                __m256i acc = _mm256_setzero_si256();
+                for(std::size_t k = 0; k != run && i + lanes <= n; ++k, i += lanes)
+                {
+                    __m256i const x =
+                        _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                    acc = detail::avx2_sub(acc, detail::avx2_cmpeq(x, v, W{}), W{});
+                }
+                U counts[lanes];
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(counts), acc);
+                for(U c : counts)
+                    total += c;
+            }
+            for(; i != n; ++i)
+                total += p[i] == val;
+            return total;
+        }
+
+        RANGES_SIMD_TARGET_AVX2 inline std::size_t avx2_mismatch_bytes(
+            unsigned char const * a, unsigned char const * b, std::size_t n) noexcept
+        {
+            std::size_t i = 0;
+            for(; i + 32 <= n; i += 32)
+            {
+                __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a + i));
+                __m256i const y = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b + i));
+                unsigned const m =
+                    static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+                if(m != 0xFFFFFFFFu)
+                    return i + detail::simd_ctz(~m);
+            }
+            return i + detail::sse2_mismatch_bytes(a + i, b + i, n - i);
+        }
+#undef RANGES_SIMD_TARGET_AVX2
+#endif // RANGES_SIMD_AVX2
+#endif // RANGES_SIMD_SSE2
+
+        // The index of the first of the n elements at p that equals val, or n.
+        template<typename T>
+        RANGES_SIMD_NOINLINE std::size_t simd_find(T const * p, std::size_t n, T val) noexcept
+        {
+#if defined(RANGES_SIMD_AVX2)
+            if(detail::simd_has_avx2())
+                return detail::avx2_find(p, n, val);
+#endif
+#if defined(RANGES_SIMD_SSE2)
+            return detail::sse2_find(p, n, val);
+#else
+            if(sizeof(T) == 1)
+            {
+                auto const q = std::memchr(p, static_cast<unsigned char>(val), n);
+                return q ? static_cast<std::size_t>(static_cast<T const *>(q) - p) : n;
+            }
+            std::size_t i = 0;
+            for(; i != n; ++i)
+                if(p[i] == val)
+                    break;
+            return i;
+#endif
+        }
+
+        // The number of the n elements at p that equal val.
+        template<typename T>
+        RANGES_SIMD_NOINLINE std::size_t simd_count(T const * p, std::size_t n, T val) noexcept
+        {
+#if defined(RANGES_SIMD_AVX2)
+            if(detail::simd_has_avx2())
+                return detail::avx2_count(p, n, val);
+#endif
+#if defined(RANGES_SIMD_SSE2)
+            return detail::sse2_count(p, n, val);
+#else
+            std::size_t total = 0;
+            for(std::size_t i = 0; i != n; ++i)
+                total += p[i] == val;
+            return total;
+#endif
+        }
+
+        // The index of the first of the n elements at a that differs from the
+        // corresponding element at b, or n.
+        template<typename T>
+        RANGES_SIMD_NOINLINE std::size_t simd_mismatch(T const * a, T const * b, std::size_t n) noexcept
+        {
+#if defined(RANGES_SIMD_SSE2)
+            auto const x = reinterpret_cast<unsigned char const *>(a);
+            auto const y = reinterpret_cast<unsigned char const *>(b);
+            std::size_t bytes;
+#if defined(RANGES_SIMD_AVX2)
+            if(detail::simd_has_avx2())
+                bytes = detail::avx2_mismatch_bytes(x, y, n * sizeof(T));
+            else
+#endif
+                bytes = detail::sse2_mismatch_bytes(x, y, n * sizeof(T));
+            return bytes / sizeof(T);
+#else
+            std::size_t i = 0;
+            for(; i != n; ++i)
+                if(a[i] != b[i])
+                    break;
+            return i;
+#endif
+        }
+
+        template<typename I>
+        iter_value_t<I> const * simd_data(I i) noexcept
+        {
+            return std::addressof(*i);
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,116 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_TRIVIAL_COPY_HPP
+#define RANGES_V3_DETAIL_TRIVIAL_COPY_HPP
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Whether assigning the elements of [I, S) to the elements of O (by copy,
+        // or by move if Move is true) is the same as copying their bytes with
+        // memmove: both sides are contiguous arrays of the same trivially
+        // copyable type and the length of [I, S) can be computed in O(1).
+        template<typename I, typename S, typename O, bool Move,
+                 bool = contiguous_iterator<I> && contiguous_iterator<O> &&
+                        sized_sentinel_for<S, I>>
+        struct is_memmovable_ : std::false_type
+        {};
+
+        template<typename I, typename S, typename O, bool Move>
+        struct is_memmovable_<I, S, O, Move, true>
+          : meta::bool_<
+                RANGES_IS_SAME(iter_value_t<I>, iter_value_t<O>) &&
+                (RANGES_IS_SAME(iter_reference_t<I>, iter_value_t<I> &) ||
+                 RANGES_IS_SAME(iter_reference_t<I>, iter_value_t<I> const &)) &&
+                RANGES_IS_SAME(iter_reference_t<O>, iter_value_t<O> &) &&
+                is_trivially_copyable_v<iter_value_t<O>> &&
+                (Move ? is_trivially_move_assignable_v<iter_value_t<O>>
+                      : is_trivially_copy_assignable_v<iter_value_t<O>>)>
+        {};
+
+        template<typename I, typename S, typename O, bool Move = false>
+        using is_memmovable = meta::bool_<is_memmovable_<I, S, O, Move>::value>;
+
+        // Whether assigning a V to every element of [O, S) is the same as
+        // setting their bytes with memset.
+        template<typename O, typename S, typename V,
+                 bool = contiguous_iterator<O> && sized_sentinel_for<S, O>>
+        struct is_memsettable_ : std::false_type
+        {};
+
+        template<typename O, typename S, typename V>
+        struct is_memsettable_<O, S, V, true>
+          : meta::bool_<sizeof(iter_value_t<O>) == 1 &&
+                        std::is_scalar<iter_value_t<O>>::value &&
+                        std::is_scalar<V>::value &&
+                        RANGES_IS_SAME(iter_reference_t<O>, iter_value_t<O> &)>
+        {};
+
+        template<typename O, typename S, typename V>
+        using is_memsettable = meta::bool_<is_memsettable_<O, S, V>::value>;
+
+        // Copy the n elements starting at first to the n elements starting at
+        // out, which may overlap. Returns out + n.
+        template<typename I, typename O>
+        O memmove_n(I first, iter_difference_t<I> n, O out) noexcept
+        {
+            if(n > 0)
+                std::memmove(std::addressof(*out),
+                             std::addressof(*first),
+                             static_cast<std::size_t>(n) * sizeof(iter_value_t<O>));
+            return out + n;
+        }
+
+        // Copy the n elements starting at first to the n elements ending at
+        // out_last, which may overlap. Returns out_last - n.
+        template<typename I, typename O>
+        O memmove_backward_n(I first, iter_difference_t<I> n, O out_last) noexcept
+        {
+            O out = out_last - n;
+            detail::memmove_n(first, n, out);
+            return out;
+        }
+
+        template<typename O, typename V>
+        O memset_n(O first, iter_difference_t<O> n, V const & val) noexcept
+        {
+            if(n > 0)
+            {
+                iter_value_t<O> const v = static_cast<iter_value_t<O>>(val);
+                unsigned char byte;
+                std::memcpy(&byte, &v, 1);
+                std::memset(std::addressof(*first), byte, static_cast<std::size_t>(n));
+            }
+            return first + n;
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -28,5 +28,6 @@
 #include <range/v3/functional/overload.hpp>
 #include <range/v3/functional/pipeable.hpp>
 #include <range/v3/functional/reference_wrapper.hpp>
+#include <range/v3/functional/searcher.hpp>
 
 #endif
@@ -0,0 +1,462 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FUNCTIONAL_SEARCHER_HPP
+#define RANGES_V3_FUNCTIONAL_SEARCHER_HPP
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/subrange.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename P>
+        using searcher_key_t = uncvref_t<indirect_result_t<P &, I>>;
+
+        // Maps each key to a shift distance, defaulting to a fixed one.
+        // Integral keys index a flat table by their low byte; keys that share
+        // an entry share the smallest shift set for any of them, which is
+        // always safe. All other keys are hashed.
+        template<typename K, typename D, typename Hash,
+                 bool = std::is_integral<K>::value>
+        struct searcher_skip_table
+        {
+        private:
+            std::unordered_map<K, D, Hash> map_;
+            D default_;
+
+        public:
+            searcher_skip_table(std::size_t n, D def, Hash hash)
+              : map_(n, std::move(hash))
+              , default_(def)
+            {}
+            void set(K const & k, D d)
+            {
+                map_[k] = d;
+            }
+            D operator[](K const & k) const
+            {
+                auto const it = map_.find(k);
+                return it == map_.end() ? default_ : it->second;
+            }
+        };
+
+        template<typename K, typename D, typename Hash>
+        struct searcher_skip_table<K, D, Hash, true>
+        {
+        private:
+            std::array<D, 256> table_;
+
+        public:
+            searcher_skip_table(std::size_t, D def, Hash)
+            {
+                table_.fill(def);
+            }
+            void set(K k, D d) noexcept
+            {
+                D & e = table_[static_cast<unsigned char>(k)];
+                e = (std::min)(e, d);
+            }
+            D operator[](K k) const noexcept
+            {
+                return table_[static_cast<unsigned char>(k)];
+            }
+        };
+
+        // Holds the pattern and its projection for the searchers below.
+        template<typename I, typename P>
+        struct searcher_pattern
+        {
+        protected:
+            I first_;
+            iter_difference_t<I> size_;
+            P proj_;
+
+            searcher_pattern(I first, I last, P proj)
+              : first_(first)
+              , size_(last - first)
+              , proj_(std::move(proj))
+            {}
+            decltype(auto) key_(iter_difference_t<I> i) const
+            {
+                return invoke(proj_, first_[i]);
+            }
+
+        public:
+            using key_type = searcher_key_t<I, P>;
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-functional
+    /// @{
+
+    // clang-format off
+    /// \concept searcher_for_
+    /// The \c searcher_for_ concept
+    template(typename Searcher, typename I, typename S, typename P)(
+    concept (searcher_for_)(Searcher, I, S, P),
+        convertible_to<invoke_result_t<Searcher const &, I, S, P>, subrange<I>>
+    );
+
+    /// \concept searcher_for
+    /// The \c searcher_for concept: \c Searcher finds a pattern in the
+    /// range <tt>[I, S)</tt> whose elements are projected with \c P
+    template<typename Searcher, typename I, typename S, typename P>
+    CPP_concept searcher_for =
+        invocable<Searcher const &, I, S, P> &&
+        CPP_concept_ref(ranges::searcher_for_, Searcher, I, S, P);
+    // clang-format on
+
+    /// Finds a pattern with the Boyer-Moore-Horspool algorithm: the last
+    /// element of each window selects how far the window can move. Sublinear
+    /// on average; O(N*M) in the worst case. The pattern is not copied and
+    /// must outlive the searcher.
+    template<typename I, typename P = identity,
+             typename Hash = std::hash<detail::searcher_key_t<I, P>>>
+    struct boyer_moore_horspool_searcher : detail::searcher_pattern<I, P>
+    {
+    private:
+        CPP_assert(random_access_iterator<I>);
+        using D = iter_difference_t<I>;
+        using base_t = detail::searcher_pattern<I, P>;
+        using base_t::key_;
+        using base_t::size_;
+
+        detail::searcher_skip_table<typename base_t::key_type, D, Hash> skip_;
+
+    public:
+        boyer_moore_horspool_searcher(I first, I last, P proj = P{}, Hash hash = Hash{})
+          : base_t(first, last, std::move(proj))
+          , skip_(static_cast<std::size_t>(size_), size_, std::move(hash))
+        {
+            for(D i = 0; i < size_ - 1; ++i)
+                skip_.set(key_(i), size_ - 1 - i);
+        }
+
+        template(typename I1, typename S1, typename P1 = identity)(
+            /// \pre
+            requires random_access_iterator<I1> AND sized_sentinel_for<S1, I1> AND
+                same_as<detail::searcher_key_t<I1, P1>, typename base_t::key_type>)
+        subrange<I1> operator()(I1 first, S1 last, P1 proj = P1{}) const
+        {
+            using D1 = iter_difference_t<I1>;
+            D1 const n = last - first;
+            D1 const m = static_cast<D1>(size_);
+            if(m == 0)
+                return {first, first};
+            for(D1 i = 0; i <= n - m;
+                i += static_cast<D1>(skip_[invoke(proj, first[i + m - 1])]))
+            {
+                for(D1 j = m - 1; invoke(proj, first[i + j]) == key_(j); --j)
+                    if(j == 0)
+                        return {first + i, first + (i + m)};
+            }
+            return {first + n, first + n};
+        }
+    };
+
+    /// Finds a pattern with the Boyer-Moore algorithm, which adds a good
+    /// suffix rule to Boyer-Moore-Horspool's bad character rule. Sublinear on
+    /// average, at the cost of O(M) extra space. The pattern is not copied
+    /// and must outlive the searcher.
+    template<typename I, typename P = identity,
+             typename Hash = std::hash<detail::searcher_key_t<I, P>>>
+    struct boyer_moore_searcher : detail::searcher_pattern<I, P>
+    {
+    private:
+        CPP_assert(random_access_iterator<I>);
+        using D = iter_difference_t<I>;
+        using base_t = detail::searcher_pattern<I, P>;
+        using base_t::key_;
+        using base_t::size_;
+
+        detail::searcher_skip_table<typename base_t::key_type, D, Hash> skip_;
+        std::vector<D> good_suffix_;
+
+        void init_good_suffix()
+        {
+            D const m = size_;
+            // suffix[i]: the length of the longest common suffix of the
+            // pattern and its prefix ending at i.
+            std::vector<D> suffix(static_cast<std::size_t>(m));
+            suffix.back() = m;
+            for(D i = m - 2, f = m - 1, g = m - 1; i >= 0; --i)
+            {
+                if(i > g && suffix[static_cast<std::size_t>(i + m - 1 - f)] < i - g)
+                    suffix[static_cast<std::size_t>(i)] =
+                        suffix[static_cast<std::size_t>(i + m - 1 - f)];
+                else
+                {
+                    g = (std::min)(g, i);
+                    f = i;
+                    while(g >= 0 && key_(g) == key_(g + m - 1 - f))
+                        --g;
+                    suffix[static_cast<std::size_t>(i)] = f - g;
+                }
+            }
+            good_suffix_.assign(static_cast<std::size_t>(m), m);
+            for(D i = m - 1, j = 0; i >= -1; --i)
+                if(i == -1 || suffix[static_cast<std::size_t>(i)] == i + 1)
+                    for(; j < m - 1 - i; ++j)
+                        if(good_suffix_[static_cast<std::size_t>(j)] == m)
+                            good_suffix_[static_cast<std::size_t>(j)] = m - 1 - i;
+            for(D i = 0; i < m - 1; ++i)
+                good_suffix_[static_cast<std::size_t>(
+                    m - 1 - suffix[static_cast<std::size_t>(i)])] = m - 1 - i;
+        }
+
+    public:
+        boyer_moore_searcher(I first, I last, P proj = P{}, Hash hash = Hash{})
+          : base_t(first, last, std::move(proj))
+          , skip_(static_cast<std::size_t>(size_), size_, std::move(hash))
+        {
+            for(D i = 0; i < size_ - 1; ++i)
+                skip_.set(key_(i), size_ - 1 - i);
+            if(size_ != 0)
+                init_good_suffix();
+        }
+
+        template(typename I1, typename S1, typename P1 = identity)(
+            /// \pre
+            requires random_access_iterator<I1> AND sized_sentinel_for<S1, I1> AND
+                same_as<detail::searcher_key_t<I1, P1>, typename base_t::key_type>)
+        subrange<I1> operator()(I1 first, S1 last, P1 proj = P1{}) const
+        {
+            using D1 = iter_difference_t<I1>;
+            D1 const n = last - first;
+            D1 const m = static_cast<D1>(size_);
+            if(m == 0)
+                return {first, first};
+            for(D1 i = 0; i <= n - m;)
+            {
+                D1 j = m - 1;
+                for(; invoke(proj, first[i + j]) == key_(j); --j)
+                    if(j == 0)
+                        return {first + i, first + (i + m)};
+                D1 const bad_char =
+                    static_cast<D1>(skip_[invoke(proj, first[i + j])]) - m + 1 + j;
+                i += (std::max)(static_cast<D1>(good_suffix_[static_cast<std::size_t>(j)]),
+                                bad_char);
+            }
+            return {first + n, first + n};
+        }
+    };
+
+    /// Finds a pattern with the Two-Way algorithm of Crochemore and Perrin:
+    /// O(N+M) time in the worst case, constant extra space, and no table to
+    /// build, but the projected elements must be totally ordered. The
+    /// pattern is not copied and must outlive the searcher.
+    template<typename I, typename P = identity>
+    struct two_way_searcher : detail::searcher_pattern<I, P>
+    {
+    private:
+        CPP_assert(random_access_iterator<I>);
+        CPP_assert(totally_ordered<detail::searcher_key_t<I, P>>);
+        using D = iter_difference_t<I>;
+        using base_t = detail::searcher_pattern<I, P>;
+        using base_t::key_;
+        using base_t::size_;
+
+        D split_ = -1;     // The critical factorization is [0, split_], (split_, M)
+        D period_ = 1;     // The period of the right half
+        bool periodic_ = false; // Whether the whole pattern has that period
+
+        // The start (minus one) of the maximal suffix of the pattern under
+        // the ordering Cmp, and the period of that suffix.
+        template<typename Cmp>
+        std::pair<D, D> maximal_suffix(Cmp cmp) const
+        {
+            D ms = -1, j = 0, k = 1, p = 1;
+            while(j + k < size_)
+            {
+                auto && a = key_(j + k);
+                auto && b = key_(ms + k);
+                if(cmp(a, b))
+                {
+                    j += k;
+                    k = 1;
+                    p = j - ms;
+                }
+                else if(a == b)
+                {
+                    if(k != p)
+                        ++k;
+                    else
+                    {
+                        j += p;
+                        k = 1;
+                    }
+                }
+                else
+                {
+                    ms = j++;
+                    k = p = 1;
+                }
+            }
+            return {ms, p};
+        }
+
+    public:
+        two_way_searcher(I first, I last, P proj = P{})
+          : base_t(first, last, std::move(proj))
+        {
+            if(size_ == 0)
+                return;
+            auto const a = maximal_suffix(less{});
+            auto const b = maximal_suffix(greater{});
+            std::tie(split_, period_) = a.first > b.first ? a : b;
+            periodic_ = true;
+            for(D i = 0; i <= split_ && periodic_; ++i)
+                periodic_ = key_(i) == key_(i + period_);
+            if(!periodic_)
+                period_ = (std::max)(split_ + 1, size_ - split_ - 1) + 1;
+        }
+
+        template(typename I1, typename S1, typename P1 = identity)(
+            /// \pre
+            requires random_access_iterator<I1> AND sized_sentinel_for<S1, I1> AND
+                same_as<detail::searcher_key_t<I1, P1>, typename base_t::key_type>)
+        subrange<I1> operator()(I1 first, S1 last, P1 proj = P1{}) const
+        {
+            using D1 = iter_difference_t<I1>;
+            D1 const n = last - first;
+            D1 const m = static_cast<D1>(size_);
+            D1 const ell = static_cast<D1>(split_);
+            D1 const per = static_cast<D1>(period_);
+            if(m == 0)
+                return {first, first};
+            // In the periodic case, memory is how much of the left half is
+            // known to match after a shift by the period.
+            D1 memory = -1;
+            for(D1 j = 0; j <= n - m;)
+            {
+                D1 i = (std::max)(ell, memory) + 1;
+                while(i < m && invoke(proj, first[i + j]) == key_(i))
+                    ++i;
+                if(i < m)
+                {
+                    j += i - ell;
+                    memory = -1;
+                    continue;
+                }
+                i = ell;
+                while(i > memory && invoke(proj, first[i + j]) == key_(i))
+                    --i;
+                if(i <= memory)
+                    return {first + j, first + (j + m)};
+                j += per;
+                if(periodic_)
+                    memory = m - per - 1;
+            }
+            return {first + n, first + n};
+        }
+    };
+
+    /// \cond
+    namespace detail
+    {
+        template<template<typename...> class Searcher>
+        struct make_searcher_fn
+        {
+            template(typename I, typename S, typename P = identity, typename... Hash)(
+                /// \pre
+                requires random_access_iterator<I> AND sized_sentinel_for<S, I> AND
+                    indirectly_regular_unary_invocable<P, I>)
+            Searcher<I, P, Hash...> operator()(I first, S last, P proj = P{},
+                                               Hash... hash) const
+            {
+                auto const end = ranges::next(first, last);
+                return {std::move(first), end, std::move(proj), std::move(hash)...};
+            }
+
+            template(typename Rng, typename P = identity, typename... Hash)(
+                /// \pre
+                requires random_access_range<Rng> AND sized_range<Rng> AND
+                    borrowed_range<Rng> AND
+                    indirectly_regular_unary_invocable<P, iterator_t<Rng>>)
+            Searcher<iterator_t<Rng>, P, Hash...> operator()(Rng && rng, P proj = P{},
+                                                             Hash... hash) const
+            {
+                auto first = ranges::begin(rng);
+                auto const end = first + ranges::distance(rng);
+                return {std::move(first), end, std::move(proj), std::move(hash)...};
+            }
+        };
+
+        // Whether searching a range of I1 for a pattern of I2 is better done
+        // with a searcher once the pattern is long enough.
+        template<typename I1, typename I2, typename C, typename P1, typename P2>
+        using prefer_searcher = meta::bool_<
+            random_access_iterator<I1> && random_access_iterator<I2> &&
+            same_as<C, ranges::equal_to> &&
+            std::is_integral<searcher_key_t<I1, P1>>::value &&
+            same_as<searcher_key_t<I1, P1>, searcher_key_t<I2, P2>>>;
+
+        // Patterns shorter than this are matched element by element.
+        constexpr std::ptrdiff_t searcher_threshold = 8;
+
+        template<typename I1, typename I2, typename P1, typename P2>
+        subrange<I1> searcher_search(I1 first1, iter_difference_t<I1> n1, I2 first2,
+                                     iter_difference_t<I2> n2, P1 & proj1, P2 & proj2)
+        {
+            boyer_moore_horspool_searcher<I2, P2> const searcher{
+                first2, first2 + n2, proj2};
+            return searcher(first1, first1 + n1, proj1);
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \relates boyer_moore_horspool_searcher
+    RANGES_INLINE_VARIABLE(detail::make_searcher_fn<boyer_moore_horspool_searcher>,
+                           make_boyer_moore_horspool_searcher)
+
+    /// \relates boyer_moore_searcher
+    RANGES_INLINE_VARIABLE(detail::make_searcher_fn<boyer_moore_searcher>,
+                           make_boyer_moore_searcher)
+
+    /// \relates two_way_searcher
+    RANGES_INLINE_VARIABLE(detail::make_searcher_fn<two_way_searcher>,
+                           make_two_way_searcher)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
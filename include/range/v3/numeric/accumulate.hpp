@@ -13,22 +13,53 @@
 #ifndef RANGES_V3_NUMERIC_ACCUMULATE_HPP
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
+#include <functional>
+#include <utility>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/functional/arithmetic.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/chunked.hpp>
+#include <range/v3/detail/segmented.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        /// \concept tree_accumulable_impl_
+        /// The \c tree_accumulable_impl_ concept
+        template(typename Op, typename T, typename I, typename P)(
+        concept (tree_accumulable_impl_)(Op, T, I, P),
+            constructible_from<T, indirect_result_t<P &, I>> AND
+            assignable_from<T &, invoke_result_t<Op &, T, T>>
+        );
+
+        /// \concept tree_accumulable_
+        /// Whether a parallel accumulate can start a piece from its first
+        /// element and join the totals of two pieces with \c Op.
+        template<typename Op, typename T, typename I, typename P>
+        CPP_concept tree_accumulable_ =
+            move_constructible<T> && invocable<Op &, T, T> &&
+            CPP_concept_ref(detail::tree_accumulable_impl_, Op, T, I, P);
+        // clang-format on
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-numerics
     /// @{
     struct accumulate_fn
@@ -54,10 +85,105 @@ namespace ranges
                 assignable_from<
                     T &, indirect_result_t<Op &, T *, projected<iterator_t<Rng>, P>>>)
         T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+        {
+            return impl_(rng,
+                         std::move(init),
+                         op,
+                         proj,
+                         meta::bool_<detail::chunked_range_v<Rng>>{});
+        }
+
+        /// With a parallel execution policy, the range is split into pieces
+        /// that are accumulated concurrently, each but the first starting from
+        /// its first element, and the totals of the pieces are then joined
+        /// pairwise with \c op. \c op must therefore be associative, and it
+        /// and \c proj may be invoked from several threads at once.
+        template(typename ExecutionPolicy, typename I, typename S, typename T,
+                 typename Op = plus, typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND
+                random_access_iterator<I> AND sized_sentinel_for<S, I> AND
+                indirectly_binary_invocable_<Op, T *, projected<I, P>> AND
+                assignable_from<T &, indirect_result_t<Op &, T *, projected<I, P>>> AND
+                detail::tree_accumulable_<Op, T, I, P>)
+        T operator()(ExecutionPolicy &&, I first, S last, T init, Op op = Op{},
+                     P proj = P{}) const
+        {
+            if(!detail::is_parallel_policy_v<ExecutionPolicy>)
+                return (*this)(std::move(first), std::move(last), std::move(init),
+                               std::move(op), std::move(proj));
+            return detail::parallel_reduce<T>(
+                last - first,
+                [&](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+                    I const i = first + lo, e = first + hi;
+                    if(lo == 0)
+                        return (*this)(i, e, std::move(init), std::ref(op), std::ref(proj));
+                    T acc(invoke(proj, *i));
+                    return (*this)(i + 1, e, std::move(acc), std::ref(op), std::ref(proj));
+                },
+                [&](T left, T right) {
+                    left = invoke(op, std::move(left), std::move(right));
+                    return left;
+                });
+        }
+
+        template(typename ExecutionPolicy, typename Rng, typename T, typename Op = plus,
+                 typename P = identity)(
+            /// \pre
+            requires execution_policy<ExecutionPolicy> AND random_access_range<Rng> AND
+                sized_range<Rng> AND
+                indirectly_binary_invocable_<Op, T *, projected<iterator_t<Rng>, P>> AND
+                assignable_from<
+                    T &, indirect_result_t<Op &, T *, projected<iterator_t<Rng>, P>>> AND
+                detail::tree_accumulable_<Op, T, iterator_t<Rng>, P>)
+        T operator()(ExecutionPolicy && policy, Rng && rng, T init, Op op = Op{},
+                     P proj = P{}) const
+        {
+            auto first = begin(rng);
+            return (*this)(static_cast<ExecutionPolicy &&>(policy),
+                           first,
+                           first + ranges::distance(rng),
+                           std::move(init),
+                           std::move(op),
+                           std::move(proj));
+        }
+
+    private:
+        template<typename Rng, typename T, typename Op, typename P>
+        T impl_(Rng & rng, T init, Op & op, P & proj, std::false_type) const
+        {
+            return segmented_impl_(rng,
+                                   std::move(init),
+                                   op,
+                                   proj,
+                                   meta::bool_<detail::segmented_range_v<Rng>>{});
+        }
+        template<typename Rng, typename T, typename Op, typename P>
+        T segmented_impl_(Rng & rng, T init, Op & op, P & proj, std::false_type) const
         {
             return (*this)(
                 begin(rng), end(rng), std::move(init), std::move(op), std::move(proj));
         }
+        template<typename Rng, typename T, typename Op, typename P>
+        T segmented_impl_(Rng & rng, T init, Op & op, P & proj, std::true_type) const
+        {
+            auto visit = [&](auto first, auto last) {
+                for(; first != last; ++first)
+                    init = invoke(op, init, invoke(proj, *first));
+                return first;
+            };
+            range_access::for_each_segment(rng, visit);
+            return init;
+        }
+        template<typename Rng, typename T, typename Op, typename P>
+        T impl_(Rng & rng, T init, Op & op, P & proj, std::true_type) const
+        {
+            auto visit = [&](auto && elem) {
+                init = invoke(op, init, invoke(proj, static_cast<decltype(elem)>(elem)));
+            };
+            range_access::for_each_chunked(rng, visit);
+            return init;
+        }
     };
 
     RANGES_INLINE_VARIABLE(accumulate_fn, accumulate)
@@ -20,6 +20,7 @@
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/operations.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 
 #endif
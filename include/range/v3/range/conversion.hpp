@@ -24,9 +24,12 @@
 #include <range/v3/functional/pipeable.hpp>
 #include <range/v3/iterator/common_iterator.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
+#include <range/v3/detail/chunked.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -42,6 +45,9 @@ namespace ranges
             template<typename MetaFn, typename Fn>
             struct closure;
 
+            template<typename MetaFn, typename Alloc>
+            struct with_allocator;
+
             template<typename MetaFn, typename Rng>
             using container_t = meta::invoke<MetaFn, Rng>;
 
@@ -257,16 +263,102 @@ namespace ranges
             reservable_with_assign<C, I> && //
             sized_range<R>;
 
+        template<typename C, typename R>
+        CPP_requires(to_container_push_back_,
+            requires(C & c, range_reference_t<R> && ref) //
+            (
+                c.push_back(static_cast<range_reference_t<R> &&>(ref))
+            ));
+        // Whether ranges::to can fill a C by pushing back the elements of an R
+        // as R hands them out in chunks. See detail/chunked.hpp.
+        template<typename C, typename R>
+        CPP_concept to_container_chunked =
+            chunked_range_v<R> &&
+            CPP_requires_ref(detail::to_container_push_back_, C, R);
+        // Whether ranges::to may reserve room for an R of unknown size from
+        // its size hint and then push back its elements, instead of letting
+        // the container grow or count them in a separate pass. For a
+        // multi-pass R this is only done when the hint is tight; see
+        // to_container::fn::convert.
+        template<typename C, typename R>
+        CPP_concept to_container_hinted =
+            (!sized_range<R>) && has_size_hint_v<R> && reservable<C> &&
+            CPP_requires_ref(detail::to_container_push_back_, C, R);
+
+        // Like convertible_to_cont and convertible_to_cont_cont, for a Cont
+        // constructed with a copy of an Alloc.
+        template(typename Rng, typename Cont, typename Alloc)(
+        concept (convertible_to_cont_with_allocator_impl_)(Rng, Cont, Alloc),
+            constructible_from<range_value_t<Cont>, range_reference_t<Rng>> AND
+            constructible_from<Cont, Alloc const &> AND
+            constructible_from<
+                Cont,
+                range_cpp17_iterator_t<Rng>,
+                range_cpp17_iterator_t<Rng>,
+                Alloc const &>
+        );
+        template<typename Rng, typename Cont, typename Alloc>
+        CPP_concept convertible_to_cont_with_allocator = //
+            range_and_not_view<Cont> && //
+            move_constructible<Cont> && //
+            CPP_concept_ref(detail::convertible_to_cont_with_allocator_impl_,
+                            Rng, Cont, Alloc);
+
+        template(typename Rng, typename Cont, typename Alloc)(
+        concept (convertible_to_cont_cont_with_allocator_impl_)(Rng, Cont, Alloc),
+            range_and_not_view<range_value_t<Cont>> AND
+            invocable<
+                to_container::fn<meta::id<range_value_t<Cont>>>,
+                range_reference_t<Rng>> AND
+            constructible_from<Cont, Alloc const &> AND
+            constructible_from<
+                Cont,
+                to_container_iterator_t<Rng, Cont>,
+                to_container_iterator_t<Rng, Cont>,
+                Alloc const &>
+        );
+        template<typename Rng, typename Cont, typename Alloc>
+        CPP_concept convertible_to_cont_cont_with_allocator = //
+            range<Cont> && //
+            (!view_<Cont>) && //
+            move_constructible<Cont> && //
+            CPP_concept_ref(detail::convertible_to_cont_cont_with_allocator_impl_,
+                            Rng, Cont, Alloc);
+
+        // Whether a Cont can be constructed with the allocator of another.
+        template<typename Cont>
+        CPP_requires(allocator_aware_,
+            requires(Cont const & c) //
+            (
+                Cont(c.get_allocator())
+            ));
+        template<typename Cont>
+        CPP_concept allocator_aware =
+            CPP_requires_ref(detail::allocator_aware_, Cont);
+
         template<typename MetaFn, typename Rng>
         using container_t = meta::invoke<MetaFn, Rng>;
         // clang-format on
 
+        // Whether a ranges::to closure holds an allocator, possibly followed
+        // by other pipeables.
+        template<typename Fn>
+        RANGES_INLINE_VAR constexpr bool to_container_with_allocator_v = false;
+        template<typename MetaFn, typename Alloc>
+        RANGES_INLINE_VAR constexpr bool
+            to_container_with_allocator_v<to_container::with_allocator<MetaFn, Alloc>> =
+                true;
+        template<typename Pipeable, typename Fn>
+        RANGES_INLINE_VAR constexpr bool
+            to_container_with_allocator_v<composed<Pipeable, Fn>> =
+                to_container_with_allocator_v<Fn>;
+
         struct RANGES_STRUCT_WITH_ADL_BARRIER(to_container_closure_base)
         {
             // clang-format off
             template(typename Rng, typename MetaFn, typename Fn)(
                 /// \pre
-                requires input_range<Rng> AND
+                requires input_range<Rng> AND (!to_container_with_allocator_v<Fn>) AND
                     convertible_to_cont<Rng, container_t<MetaFn, Rng>>)
             friend constexpr auto
             operator|(Rng && rng, to_container::closure<MetaFn, Fn> fn)
@@ -276,7 +368,7 @@ namespace ranges
 
             template(typename Rng, typename MetaFn, typename Fn)(
                 /// \pre
-                requires input_range<Rng> AND
+                requires input_range<Rng> AND (!to_container_with_allocator_v<Fn>) AND
                     (!convertible_to_cont<Rng, container_t<MetaFn, Rng>>) AND
                     convertible_to_cont_cont<Rng, container_t<MetaFn, Rng>>)
             friend constexpr auto
@@ -285,6 +377,17 @@ namespace ranges
                 return static_cast<Fn &&>(fn)(static_cast<Rng &&>(rng));
             }
 
+            // Closures that hold an allocator check their own constraints.
+            template(typename Rng, typename MetaFn, typename Fn)(
+                /// \pre
+                requires input_range<Rng> AND to_container_with_allocator_v<Fn> AND
+                    invocable<Fn, Rng>)
+            friend constexpr auto
+            operator|(Rng && rng, to_container::closure<MetaFn, Fn> fn)
+            {
+                return static_cast<Fn &&>(fn)(static_cast<Rng &&>(rng));
+            }
+
             template<typename MetaFn, typename Fn, typename Pipeable>
             friend constexpr auto operator|(to_container::closure<MetaFn, Fn> sh,
                                             Pipeable pipe)
@@ -312,16 +415,18 @@ namespace ranges
         template<typename MetaFn>
         struct to_container::fn
         {
-        private:
-            template<typename Cont, typename I, typename Rng>
-            static Cont impl(Rng && rng, std::false_type)
+        protected:
+            // The Alloc packs below hold the allocator passed to ranges::to,
+            // if any, and are empty otherwise.
+            template<typename Cont, typename I, typename Rng, typename... Alloc>
+            static Cont impl(Rng && rng, std::false_type, Alloc const &... alloc)
             {
-                return Cont(I{ranges::begin(rng)}, I{ranges::end(rng)});
+                return Cont(I{ranges::begin(rng)}, I{ranges::end(rng)}, alloc...);
             }
-            template<typename Cont, typename I, typename Rng>
-            static auto impl(Rng && rng, std::true_type)
+            template<typename Cont, typename I, typename Rng, typename... Alloc>
+            static auto impl(Rng && rng, std::true_type, Alloc const &... alloc)
             {
-                Cont c;
+                Cont c(alloc...);
                 auto const rng_size = ranges::size(rng);
                 using size_type = decltype(c.max_size());
                 using C = common_type_t<range_size_t<Rng>, size_type>;
@@ -331,6 +436,89 @@ namespace ranges
                 return c;
             }
 
+            template<typename Cont, typename I, typename Rng, typename Reserve,
+                     typename... Alloc>
+            static Cont convert(Rng && rng, Reserve use_reserve, std::false_type,
+                                Alloc const &... alloc)
+            {
+                return impl<Cont, I>(static_cast<Rng &&>(rng), use_reserve, alloc...);
+            }
+            template<typename Cont, typename I, typename Rng, typename Reserve,
+                     typename... Alloc>
+            static Cont convert(Rng && rng, Reserve use_reserve, std::true_type,
+                                Alloc const &... alloc)
+            {
+                // Constructing from iterators counts the elements of a
+                // multi-pass range and allocates once, which pushing back
+                // after reserving for a loose hint would not.
+                if(RANGES_CONSTEXPR_IF(forward_range<Rng> && !chunked_range_v<Rng> &&
+                                       has_size_hint_v<Rng>))
+                {
+                    if(!detail::size_hint_tight(ranges::size_hint(rng)))
+                        return impl<Cont, I>(
+                            static_cast<Rng &&>(rng), use_reserve, alloc...);
+                }
+                Cont c(alloc...);
+                reserve(c, rng, meta::bool_<reservable<Cont> && has_size_hint_v<Rng>>{});
+                auto visit = [&c](auto && elem) {
+                    c.push_back(static_cast<decltype(elem)>(elem));
+                };
+                for_each_(rng, visit, meta::bool_<chunked_range_v<Rng>>{});
+                return c;
+            }
+            template<typename Cont, typename Rng>
+            static void reserve(Cont & c, Rng & rng, std::true_type)
+            {
+                using size_type = decltype(c.max_size());
+                auto const n = detail::size_hint_capacity(ranges::size_hint(rng));
+                auto const max = static_cast<std::size_t>(c.max_size());
+                c.reserve(static_cast<size_type>(n < max ? n : max));
+            }
+            template<typename Cont, typename Rng>
+            static void reserve(Cont &, Rng &, std::false_type)
+            {}
+            template<typename Rng, typename F>
+            static void for_each_(Rng & rng, F & f, std::true_type)
+            {
+                range_access::for_each_chunked(rng, f);
+            }
+            template<typename Rng, typename F>
+            static void for_each_(Rng & rng, F & f, std::false_type)
+            {
+                for(auto first = ranges::begin(rng), last = ranges::end(rng);
+                    first != last;
+                    ++first)
+                    f(*first);
+            }
+
+            template<typename Cont, typename Rng, typename... Alloc>
+            static Cont convert_(Rng && rng, Alloc const &... alloc)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using iter_t = range_cpp17_iterator_t<Rng>;
+                using use_reserve_t =
+                    meta::bool_<(bool)to_container_reserve<Cont, iter_t, Rng>>;
+                using use_push_back_t =
+                    meta::bool_<(bool)to_container_chunked<Cont, Rng> ||
+                                (bool)to_container_hinted<Cont, Rng>>;
+                return convert<Cont, iter_t>(static_cast<Rng &&>(rng),
+                                             use_reserve_t{},
+                                             use_push_back_t{},
+                                             alloc...);
+            }
+            template<typename Cont, typename Rng, typename... Alloc>
+            static Cont convert_nested_(Rng && rng, Alloc const &... alloc)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using iter_t = to_container_iterator<Rng, Cont>;
+                using use_reserve_t =
+                    meta::bool_<(bool)to_container_reserve<Cont, iter_t, Rng>>;
+                return impl<Cont, iter_t>(
+                    static_cast<Rng &&>(rng), use_reserve_t{}, alloc...);
+            }
+
         public:
             template(typename Rng)(
                 /// \pre
@@ -338,13 +526,7 @@ namespace ranges
                     convertible_to_cont<Rng, container_t<MetaFn, Rng>>)
             container_t<MetaFn, Rng> operator()(Rng && rng) const
             {
-                static_assert(!is_infinite<Rng>::value,
-                              "Attempt to convert an infinite range to a container.");
-                using cont_t = container_t<MetaFn, Rng>;
-                using iter_t = range_cpp17_iterator_t<Rng>;
-                using use_reserve_t =
-                    meta::bool_<(bool)to_container_reserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return convert_<container_t<MetaFn, Rng>>(static_cast<Rng &&>(rng));
             }
             template(typename Rng)(
                 /// \pre
@@ -353,13 +535,46 @@ namespace ranges
                     convertible_to_cont_cont<Rng, container_t<MetaFn, Rng>>)
             container_t<MetaFn, Rng> operator()(Rng && rng) const
             {
-                static_assert(!is_infinite<Rng>::value,
-                              "Attempt to convert an infinite range to a container.");
-                using cont_t = container_t<MetaFn, Rng>;
-                using iter_t = to_container_iterator<Rng, cont_t>;
-                using use_reserve_t =
-                    meta::bool_<(bool)to_container_reserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return convert_nested_<container_t<MetaFn, Rng>>(
+                    static_cast<Rng &&>(rng));
+            }
+        };
+
+        // Like to_container::fn, but constructs the container with a copy of
+        // the allocator passed to ranges::to.
+        template<typename MetaFn, typename Alloc>
+        struct to_container::with_allocator : private to_container::fn<MetaFn>
+        {
+        private:
+            Alloc alloc_;
+
+        public:
+            with_allocator() = default;
+            constexpr explicit with_allocator(Alloc alloc)
+              : alloc_(std::move(alloc))
+            {}
+
+            template(typename Rng)(
+                /// \pre
+                requires input_range<Rng> AND
+                    convertible_to_cont_with_allocator<Rng, container_t<MetaFn, Rng>,
+                                                       Alloc>)
+            container_t<MetaFn, Rng> operator()(Rng && rng) const
+            {
+                return this->template convert_<container_t<MetaFn, Rng>>(
+                    static_cast<Rng &&>(rng), alloc_);
+            }
+            template(typename Rng)(
+                /// \pre
+                requires input_range<Rng> AND
+                    (!convertible_to_cont_with_allocator<Rng, container_t<MetaFn, Rng>,
+                                                         Alloc>) AND
+                    convertible_to_cont_cont_with_allocator<Rng, container_t<MetaFn, Rng>,
+                                                            Alloc>)
+            container_t<MetaFn, Rng> operator()(Rng && rng) const
+            {
+                return this->template convert_nested_<container_t<MetaFn, Rng>>(
+                    static_cast<Rng &&>(rng), alloc_);
             }
         };
 
@@ -369,6 +584,10 @@ namespace ranges
         template<typename MetaFn>
         using to_container_fn = to_container_closure<MetaFn, to_container::fn<MetaFn>>;
 
+        template<typename MetaFn, typename Alloc>
+        using to_container_with_allocator_fn =
+            to_container_closure<MetaFn, to_container::with_allocator<MetaFn, Alloc>>;
+
         template<template<typename...> class ContT>
         struct from_range
         {
@@ -454,6 +673,58 @@ namespace ranges
             return detail::to_container_fn<meta::id<Cont>>{}(static_cast<Rng &&>(rng));
         }
 
+        /// \brief For initializing a container of the specified type with the elements of
+        /// a Range, constructing the container with a copy of \p alloc, as in
+        /// <tt>rng | ranges::to<std::pmr::vector<int>>(&resource)</tt>.
+        template(typename Cont, typename Alloc)(
+            /// \pre
+            requires (!range<Alloc>) AND copy_constructible<Alloc>)
+        auto to(Alloc alloc)
+            -> detail::to_container_with_allocator_fn<meta::id<Cont>, Alloc>
+        {
+            return detail::to_container_with_allocator_fn<meta::id<Cont>, Alloc>{
+                detail::to_container::with_allocator<meta::id<Cont>, Alloc>{
+                    std::move(alloc)}};
+        }
+
+        /// \overload
+        template(template<typename...> class ContT, typename Alloc)(
+            /// \pre
+            requires (!range<Alloc>) AND copy_constructible<Alloc>)
+        auto to(Alloc alloc)
+            -> detail::to_container_with_allocator_fn<detail::from_range<ContT>, Alloc>
+        {
+            return detail::to_container_with_allocator_fn<detail::from_range<ContT>,
+                                                          Alloc>{
+                detail::to_container::with_allocator<detail::from_range<ContT>, Alloc>{
+                    std::move(alloc)}};
+        }
+
+        /// \overload
+        template(typename Cont, typename Rng, typename Alloc)(
+            /// \pre
+            requires range<Rng> AND
+                invocable<detail::to_container::with_allocator<meta::id<Cont>, Alloc>,
+                          Rng>)
+        auto to(Rng && rng, Alloc alloc) -> Cont
+        {
+            return detail::to_container::with_allocator<meta::id<Cont>, Alloc>{
+                std::move(alloc)}(static_cast<Rng &&>(rng));
+        }
+
+        /// \overload
+        template(template<typename...> class ContT, typename Rng, typename Alloc)(
+            /// \pre
+            requires range<Rng> AND
+                invocable<
+                    detail::to_container::with_allocator<detail::from_range<ContT>, Alloc>,
+                    Rng>)
+        auto to(Rng && rng, Alloc alloc) -> ContT<range_value_t<Rng>>
+        {
+            return detail::to_container::with_allocator<detail::from_range<ContT>, Alloc>{
+                std::move(alloc)}(static_cast<Rng &&>(rng));
+        }
+
         /// \cond
         // Slightly odd initializer_list overloads, undocumented for now.
         template(template<typename...> class ContT, typename T)(
@@ -531,6 +802,42 @@ namespace ranges
     } // namespace _to_
     /// \endcond
 
+    /// \cond
+    namespace detail
+    {
+        // The result of actions::split and actions::split_when: a vector of
+        // the pieces of rng, which are containers of the same type as rng,
+        // and use its allocator, when rng is a container.
+        template<typename Cont, typename Pieces, typename Rng>
+        std::vector<Cont> to_split_pieces_(Pieces && pieces, Rng const &,
+                                           std::false_type)
+        {
+            return static_cast<Pieces &&>(pieces) | to<std::vector<Cont>>();
+        }
+        template<typename Cont, typename Pieces, typename Rng>
+        std::vector<Cont> to_split_pieces_(Pieces && pieces, Rng const & rng,
+                                           std::true_type)
+        {
+            std::vector<Cont> ret;
+            auto const to_piece = to<Cont>(rng.get_allocator());
+            for(auto first = ranges::begin(pieces), last = ranges::end(pieces);
+                first != last;
+                ++first)
+                ret.push_back(to_piece(*first));
+            return ret;
+        }
+        template<typename Cont, typename Pieces, typename Rng>
+        std::vector<Cont> to_split_pieces(Pieces && pieces, Rng const & rng)
+        {
+            using use_allocator_t =
+                meta::bool_<container<Rng> && same_as<Cont, uncvref_t<Rng>> &&
+                            allocator_aware<Cont>>;
+            return detail::to_split_pieces_<Cont>(
+                static_cast<Pieces &&>(pieces), rng, use_allocator_t{});
+        }
+    } // namespace detail
+    /// \endcond
+
     template<typename MetaFn, typename Fn>
     RANGES_INLINE_VAR constexpr bool
         is_pipeable_v<detail::to_container_closure<MetaFn, Fn>> = true;
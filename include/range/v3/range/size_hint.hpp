@@ -0,0 +1,186 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_RANGE_SIZE_HINT_HPP
+#define RANGES_V3_RANGE_SIZE_HINT_HPP
+
+#include <cstddef>
+#include <limits>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-range
+    /// @{
+
+    /// Bounds on the number of elements of a range, as returned by
+    /// \c ranges::size_hint: at least \c lower, and at most \c upper, which is
+    /// \c unbounded() when nothing is known.
+    struct size_hint_t
+    {
+        std::size_t lower = 0;
+        std::size_t upper = unbounded();
+
+        static constexpr std::size_t unbounded() noexcept
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+        constexpr bool bounded() const noexcept
+        {
+            return upper != unbounded();
+        }
+
+        /// The bounds on the size of two ranges laid end to end
+        friend constexpr size_hint_t operator+(size_hint_t a, size_hint_t b) noexcept
+        {
+            return {a.lower + b.lower < a.lower ? unbounded() : a.lower + b.lower,
+                    a.upper + b.upper < a.upper ? unbounded() : a.upper + b.upper};
+        }
+        friend constexpr bool operator==(size_hint_t a, size_hint_t b) noexcept
+        {
+            return a.lower == b.lower && a.upper == b.upper;
+        }
+        friend constexpr bool operator!=(size_hint_t a, size_hint_t b) noexcept
+        {
+            return !(a == b);
+        }
+    };
+
+    /// \cond
+    namespace _size_hint_
+    {
+        template<typename T>
+        void size_hint(T &&) = delete;
+
+        // clang-format off
+        template<typename T>
+        CPP_requires(has_member_size_hint_,
+            requires(T && t) //
+            (
+                concepts::requires_<same_as<
+                    decltype(((T &&) t).size_hint()), size_hint_t>>
+            ));
+        template<typename T>
+        CPP_concept has_member_size_hint =
+            CPP_requires_ref(_size_hint_::has_member_size_hint_, T);
+
+        template<typename T>
+        CPP_requires(has_non_member_size_hint_,
+            requires(T && t) //
+            (
+                concepts::requires_<same_as<
+                    decltype(size_hint((T &&) t)), size_hint_t>>
+            ));
+        template<typename T>
+        CPP_concept has_non_member_size_hint =
+            CPP_requires_ref(_size_hint_::has_non_member_size_hint_, T);
+        // clang-format on
+
+        struct fn
+        {
+            template(typename R)(
+                /// \pre
+                requires sized_range<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                auto const n = static_cast<std::size_t>(ranges::size(r));
+                return {n, n};
+            }
+
+            template(typename R)(
+                /// \pre
+                requires (!sized_range<R>) AND has_member_size_hint<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                return ((R &&) r).size_hint();
+            }
+
+            template(typename R)(
+                /// \pre
+                requires (!sized_range<R>) AND (!has_member_size_hint<R>) AND
+                    has_non_member_size_hint<R>)
+            constexpr size_hint_t operator()(R && r) const
+            {
+                return size_hint((R &&) r);
+            }
+
+            template(typename R)(
+                /// \pre
+                requires (!sized_range<R>) AND (!has_member_size_hint<R>) AND
+                    (!has_non_member_size_hint<R>))
+            constexpr size_hint_t operator()(R &&) const noexcept
+            {
+                return {};
+            }
+        };
+    } // namespace _size_hint_
+    /// \endcond
+
+    /// \return For a given expression `E` of type `T`, `ranges::size_hint(E)`
+    /// is:
+    ///   * `{n, n}` with `n = ranges::size(E)` if `T` models `sized_range`.
+    ///   * Otherwise, `E.size_hint()` if it is a valid expression of type
+    ///     `size_hint_t`.
+    ///   * Otherwise, `size_hint(E)` if it is a valid expression of type
+    ///     `size_hint_t`, found by argument-dependent lookup.
+    ///   * Otherwise, `size_hint_t{}`: nothing is known.
+    ///
+    /// Views whose size is not known in constant time, like \c views::filter,
+    /// \c views::join and \c views::concat of unsized ranges, provide a
+    /// \c size_hint() member so that \c ranges::to and \c actions::push_back
+    /// can allocate once.
+    RANGES_DEFINE_CPO(_size_hint_::fn, size_hint)
+
+    /// \cond
+    namespace detail
+    {
+        // Whether ranges::size_hint(r) can say more than "nothing is known".
+        template<typename R>
+        RANGES_INLINE_VAR constexpr bool has_size_hint_v =
+            sized_range<R> || _size_hint_::has_member_size_hint<R> ||
+            _size_hint_::has_non_member_size_hint<R>;
+
+        // The capacity to reserve for a range with the given size hint: its
+        // upper bound when that is at most twice its lower bound, so that at
+        // most half of it goes unused, and its lower bound otherwise. A
+        // filter of a large range, whose upper bound is the size of that
+        // range, reserves nothing.
+        constexpr std::size_t size_hint_capacity(size_hint_t hint) noexcept
+        {
+            return hint.upper / 2 <= hint.lower ? hint.upper : hint.lower;
+        }
+
+        // Whether reserving for a size hint sizes the container for good: its
+        // upper bound is non-zero and at most twice its lower bound. When it
+        // is not, a multi-pass range is better counted than pushed back.
+        constexpr bool size_hint_tight(size_hint_t hint) noexcept
+        {
+            return hint.upper != 0 && hint.upper / 2 <= hint.lower;
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -615,6 +615,9 @@ namespace ranges
         struct all_fn;
     }
 
+    template<typename Rng>
+    struct chunk_view;
+
     template<typename Rng>
     struct const_view;
 
@@ -20,6 +20,8 @@
 #include <range/v3/utility/common_type.hpp>
 #include <range/v3/utility/compressed_pair.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/eytzinger.hpp>
 #include <range/v3/utility/get.hpp>
 #include <range/v3/utility/in_place.hpp>
 #include <range/v3/utility/memory.hpp>
@@ -31,6 +33,7 @@
 #include <range/v3/utility/semiregular_box.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 #include <range/v3/utility/tuple_algorithm.hpp>
 #include <range/v3/utility/variant.hpp>
 
@@ -0,0 +1,192 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EXECUTION_HPP
+#define RANGES_V3_UTILITY_EXECUTION_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+    namespace execution
+    {
+        /// Requests that an algorithm executes sequentially on the calling
+        /// thread.
+        struct sequenced_policy
+        {};
+
+        /// Permits an algorithm to divide its work among several threads.
+        /// Element access functions and the function objects passed to the
+        /// algorithm may be invoked concurrently.
+        struct parallel_policy
+        {};
+
+        /// Like \c parallel_policy, and additionally permits the invocations
+        /// made on one thread to be interleaved (vectorized).
+        struct parallel_unsequenced_policy
+        {};
+
+        RANGES_INLINE_VARIABLE(sequenced_policy, seq)
+        RANGES_INLINE_VARIABLE(parallel_policy, par)
+        RANGES_INLINE_VARIABLE(parallel_unsequenced_policy, par_unseq)
+    } // namespace execution
+
+    template<typename T>
+    RANGES_INLINE_VAR constexpr bool is_execution_policy_v = false;
+
+    template<>
+    RANGES_INLINE_VAR constexpr bool is_execution_policy_v<execution::sequenced_policy> =
+        true;
+
+    template<>
+    RANGES_INLINE_VAR constexpr bool is_execution_policy_v<execution::parallel_policy> =
+        true;
+
+    template<>
+    RANGES_INLINE_VAR constexpr bool
+        is_execution_policy_v<execution::parallel_unsequenced_policy> = true;
+
+    template<typename T>
+    struct is_execution_policy : meta::bool_<is_execution_policy_v<T>>
+    {};
+
+    /// \concept execution_policy
+    /// The \c execution_policy concept
+    template<typename T>
+    CPP_concept execution_policy = is_execution_policy_v<uncvref_t<T>>;
+
+    /// \cond
+    namespace detail
+    {
+        template<typename T>
+        RANGES_INLINE_VAR constexpr bool is_parallel_policy_v =
+            execution_policy<T> &&
+            !RANGES_IS_SAME(uncvref_t<T>, execution::sequenced_policy);
+
+        // The number of times a divide-and-conquer algorithm should split its
+        // work in two so that every thread of the current pool, and the thread
+        // waiting on it, gets (roughly) two tasks.
+        inline int parallel_fork_depth()
+        {
+            int depth = 1;
+            for(std::size_t n = thread_pool::current().size() + 1u; n > 1u; n >>= 1)
+                ++depth;
+            return depth;
+        }
+
+        // Evaluate f() and g() concurrently on the current thread pool,
+        // returning when both are done. If either throws, the exception is
+        // propagated to the caller after both have finished.
+        template<typename F, typename G>
+        void parallel_invoke(F && f, G && g)
+        {
+            thread_pool::current().fork_join(static_cast<F &&>(f), static_cast<G &&>(g));
+        }
+
+        // Below this many elements, a parallel loop or reduction does not split
+        // its work any further.
+        constexpr std::ptrdiff_t parallel_grain_size()
+        {
+            return 1 << 11;
+        }
+
+        template<typename F>
+        void parallel_for_(std::ptrdiff_t lo, std::ptrdiff_t hi, int fork_depth,
+                           std::ptrdiff_t grain, F & f)
+        {
+            if(fork_depth > 0 && hi - lo > grain)
+            {
+                std::ptrdiff_t const mid = lo + (hi - lo) / 2;
+                detail::parallel_invoke(
+                    [=, &f] { detail::parallel_for_(mid, hi, fork_depth - 1, grain, f); },
+                    [=, &f] { detail::parallel_for_(lo, mid, fork_depth - 1, grain, f); });
+            }
+            else
+                f(lo, hi);
+        }
+
+        // Calls f(lo, hi) for disjoint pieces [lo, hi) that together make up
+        // [0, n), several at a time, and returns when all are done.
+        template<typename F>
+        void parallel_for(std::ptrdiff_t n, F f)
+        {
+            detail::parallel_for_(
+                0, n, detail::parallel_fork_depth(), detail::parallel_grain_size(), f);
+        }
+
+        // Like parallel_for, but for pieces that are already expensive: [0, n)
+        // is split all the way down to pieces of at most grain, and idle
+        // threads of the pool steal what is left.
+        template<typename F>
+        void parallel_for(std::ptrdiff_t n, std::ptrdiff_t grain, F f)
+        {
+            detail::parallel_for_(0, n, std::numeric_limits<int>::max(), grain, f);
+        }
+
+        template<typename T, typename R, typename C>
+        T parallel_reduce_(std::ptrdiff_t lo, std::ptrdiff_t hi, int fork_depth,
+                           R & reduce, C & combine)
+        {
+            if(fork_depth > 0 && hi - lo > detail::parallel_grain_size())
+            {
+                std::ptrdiff_t const mid = lo + (hi - lo) / 2;
+                optional<T> left, right;
+                detail::parallel_invoke(
+                    [&] {
+                        right.emplace(detail::parallel_reduce_<T>(
+                            mid, hi, fork_depth - 1, reduce, combine));
+                    },
+                    [&] {
+                        left.emplace(detail::parallel_reduce_<T>(
+                            lo, mid, fork_depth - 1, reduce, combine));
+                    });
+                return combine(std::move(*left), std::move(*right));
+            }
+            return reduce(lo, hi);
+        }
+
+        // Tree reduction of [0, n): reduce(lo, hi) computes the value of each
+        // piece, several at a time, and combine(a, b) joins the values of
+        // neighbouring pieces, left one first. The result is the same as a
+        // left fold whenever combine is associative.
+        template<typename T, typename R, typename C>
+        T parallel_reduce(std::ptrdiff_t n, R reduce, C combine)
+        {
+            return detail::parallel_reduce_<T>(
+                0, n, detail::parallel_fork_depth(), reduce, combine);
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
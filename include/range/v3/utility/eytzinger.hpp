@@ -0,0 +1,311 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EYTZINGER_HPP
+#define RANGES_V3_UTILITY_EYTZINGER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/basic_iterator.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/subrange.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        // Positions in the Eytzinger layout are numbered from 1, the root; the
+        // children of node k are 2k and 2k+1, and 0 is past the end.
+
+        // The node that follows k in sorted order.
+        inline std::size_t eytzinger_next(std::size_t k, std::size_t n) noexcept
+        {
+            if(2 * k + 1 <= n)
+            {
+                for(k = 2 * k + 1; 2 * k <= n; k *= 2)
+                    ;
+                return k;
+            }
+            // Up past every node of which k is in the right subtree.
+            for(; k & 1u; k /= 2)
+                ;
+            return k / 2;
+        }
+
+        // The node that precedes k in sorted order, the last one if k is 0.
+        inline std::size_t eytzinger_prev(std::size_t k, std::size_t n) noexcept
+        {
+            if(k == 0)
+            {
+                for(k = n == 0 ? 0 : 1; 2 * k + 1 <= n; k = 2 * k + 1)
+                    ;
+                return k;
+            }
+            if(2 * k <= n)
+            {
+                for(k = 2 * k; 2 * k + 1 <= n; k = 2 * k + 1)
+                    ;
+                return k;
+            }
+            for(; k != 1 && !(k & 1u); k /= 2)
+                ;
+            return k / 2;
+        }
+
+        // The node a search ends at when it went right at each of the last
+        // nodes it visited: the last node it went left at.
+        inline std::size_t eytzinger_unwind(std::size_t k) noexcept
+        {
+            for(; k & 1u; k /= 2)
+                ;
+            return k / 2;
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// A read-only sorted sequence stored in Eytzinger order, the order of a
+    /// breadth-first walk of the balanced binary search tree over its
+    /// elements. A search visits the elements it compares in increasing
+    /// positions, and the two children of a node are adjacent, so the top
+    /// levels of the tree share a few cache lines and the search prefetches
+    /// the nodes it may visit a few levels down. For large arrays, \c
+    /// lower_bound and \c upper_bound are faster than binary searches of the
+    /// sorted order, which jump back and forth across the whole array.
+    ///
+    /// Iterating yields the elements in sorted order. The searches take the
+    /// ordering and projection to search by, which must be the order the
+    /// elements were given in.
+    template<typename T, typename Alloc = std::allocator<T>>
+    struct eytzinger_array
+    {
+    private:
+        // The elements of the node this many times deeper than the one a
+        // search is at fill one cache line or so, and are prefetched.
+        static constexpr std::size_t prefetch_stride =
+            sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+
+        std::vector<T, Alloc> data_;
+
+        struct cursor
+        {
+        private:
+            eytzinger_array const * arr_ = nullptr;
+            std::size_t k_ = 0;
+
+        public:
+            cursor() = default;
+            cursor(eytzinger_array const & arr, std::size_t k)
+              : arr_(&arr)
+              , k_(k)
+            {}
+            T const & read() const
+            {
+                return arr_->data_[k_ - 1];
+            }
+            void next()
+            {
+                k_ = detail::eytzinger_next(k_, arr_->data_.size());
+            }
+            void prev()
+            {
+                k_ = detail::eytzinger_prev(k_, arr_->data_.size());
+            }
+            bool equal(cursor const & that) const
+            {
+                return k_ == that.k_;
+            }
+        };
+
+        template<typename V, typename C, typename P>
+        std::size_t lower_bound_(V const & val, C & pred, P & proj) const
+        {
+            std::size_t const n = data_.size();
+            T const * const data = data_.data();
+            std::size_t k = 1;
+            while(k <= n)
+            {
+                if(k * prefetch_stride <= n)
+                    RANGES_PREFETCH(data + (k * prefetch_stride - 1));
+                k = 2 * k + invoke(pred, invoke(proj, data[k - 1]), val);
+            }
+            return detail::eytzinger_unwind(k);
+        }
+        template<typename V, typename C, typename P>
+        std::size_t upper_bound_(V const & val, C & pred, P & proj) const
+        {
+            std::size_t const n = data_.size();
+            T const * const data = data_.data();
+            std::size_t k = 1;
+            while(k <= n)
+            {
+                if(k * prefetch_stride <= n)
+                    RANGES_PREFETCH(data + (k * prefetch_stride - 1));
+                k = 2 * k + !invoke(pred, val, invoke(proj, data[k - 1]));
+            }
+            return detail::eytzinger_unwind(k);
+        }
+
+        // Fills the subtree at k, in order, from the next elements of it.
+        template<typename I>
+        void fill_(std::size_t k, I & it)
+        {
+            if(k > data_.size())
+                return;
+            fill_(2 * k, it);
+            data_[k - 1] = *it;
+            ++it;
+            fill_(2 * k + 1, it);
+        }
+        template<typename Rng>
+        void assign_(Rng & rng, std::true_type)
+        {
+            data_.resize(static_cast<std::size_t>(ranges::size(rng)));
+            auto it = ranges::begin(rng);
+            fill_(1, it);
+        }
+        template<typename Rng>
+        void assign_(Rng & rng, std::false_type)
+        {
+            std::vector<T, Alloc> sorted(data_.get_allocator());
+            RANGES_FOR(auto && t, rng)
+                sorted.emplace_back(static_cast<decltype(t) &&>(t));
+
+            // The rank in sorted order of each node, by an in-order walk.
+            std::size_t const n = sorted.size();
+            std::vector<std::size_t> rank(n + 1);
+            std::size_t k = detail::eytzinger_next(0, n);
+            for(std::size_t i = 0; i != n; ++i, k = detail::eytzinger_next(k, n))
+                rank[k] = i;
+            data_.reserve(n);
+            for(k = 1; k <= n; ++k)
+                data_.push_back(std::move(sorted[rank[k]]));
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using allocator_type = Alloc;
+        using const_iterator = basic_iterator<cursor>;
+        using iterator = const_iterator;
+
+        eytzinger_array() = default;
+        explicit eytzinger_array(Alloc const & alloc)
+          : data_(alloc)
+        {}
+        /// \pre The elements of \c rng are sorted.
+        ///
+        /// A sized range is read once, straight into place. Any other range
+        /// is copied first, to count it.
+        template(typename Rng)(
+            /// \pre
+            requires input_range<Rng> AND
+                constructible_from<T, range_reference_t<Rng>>)
+        explicit eytzinger_array(Rng && rng, Alloc const & alloc = Alloc())
+          : data_(alloc)
+        {
+            assign_(rng,
+                    meta::bool_<sized_range<Rng> && default_constructible<T> &&
+                                assignable_from<T &, range_reference_t<Rng>>>{});
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator{cursor{*this, detail::eytzinger_next(0, size())}};
+        }
+        const_iterator end() const
+        {
+            return const_iterator{cursor{*this, std::size_t{0}}};
+        }
+        size_type size() const noexcept
+        {
+            return data_.size();
+        }
+        bool empty() const noexcept
+        {
+            return data_.empty();
+        }
+        /// The elements in Eytzinger order
+        T const * data() const noexcept
+        {
+            return data_.data();
+        }
+        allocator_type get_allocator() const
+        {
+            return data_.get_allocator();
+        }
+
+        /// The first element whose projection is not less than \c val, as by
+        /// \c ranges::lower_bound on the elements in sorted order
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        const_iterator lower_bound(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            return const_iterator{cursor{*this, lower_bound_(val, pred, proj)}};
+        }
+        /// The first element whose projection is greater than \c val, as by
+        /// \c ranges::upper_bound on the elements in sorted order
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        const_iterator upper_bound(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            return const_iterator{cursor{*this, upper_bound_(val, pred, proj)}};
+        }
+        /// The elements whose projections are equivalent to \c val
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        subrange<const_iterator> equal_range(V const & val, C pred = C{},
+                                             P proj = P{}) const
+        {
+            return {lower_bound(val, pred, proj), upper_bound(val, pred, proj)};
+        }
+        /// Whether an element has a projection equivalent to \c val
+        template(typename V, typename C = less, typename P = identity)(
+            /// \pre
+            requires indirect_strict_weak_order<C, V const *, projected<T const *, P>>)
+        bool contains(V const & val, C pred = C{}, P proj = P{}) const
+        {
+            std::size_t const k = lower_bound_(val, pred, proj);
+            return k != 0 && !invoke(pred, val, invoke(proj, data_[k - 1]));
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -47,7 +47,7 @@ namespace ranges
                 n = PTRDIFF_MAX / sizeof(T);
 
             void * ptr = nullptr;
-            for(; ptr == nullptr && n > 0; n /= 2)
+            for(; n > 0; n /= 2)
             {
 #if RANGES_CXX_ALIGNED_NEW < RANGES_CXX_ALIGNED_NEW_17
                 static_assert(alignof(T) <= alignof(std::max_align_t),
@@ -59,6 +59,8 @@ namespace ranges
                 else
 #endif // RANGES_CXX_ALIGNED_NEW
                 ptr = ::operator new(sizeof(T) * n, std::nothrow);
+                if(ptr != nullptr)
+                    break;
             }
 
             return {static_cast<T *>(ptr), static_cast<std::ptrdiff_t>(n)};
@@ -49,6 +49,7 @@
 #include <initializer_list>
 #include <new>
 #include <random>
+#include <utility>
 
 #include <meta/meta.hpp>
 
@@ -487,6 +488,143 @@ namespace ranges
 
             return engine;
         }
+
+        constexpr std::size_t urbg_bits_value_(std::uint64_t min, std::uint64_t max)
+        {
+            return min != 0 ? 0
+                   : max == UINT64_MAX ? 64
+                   : max >= UINT32_MAX && (max & (max + 1)) == 0 ? 32 : 0;
+        }
+
+        // How many uniformly random low bits each call to a Gen yields without
+        // further work: 64 when it yields every 64-bit value, 32 when its values
+        // are all those of 32 bits or more, and 0 otherwise.
+        template<typename Gen>
+        using urbg_bits_ = meta::size_t<detail::urbg_bits_value_(
+            static_cast<std::uint64_t>(Gen::min()), static_cast<std::uint64_t>(Gen::max()))>;
+
+        template<typename Gen>
+        std::uint32_t random_u32_(Gen & gen, meta::size_t<0>)
+        {
+            return std::uniform_int_distribution<std::uint32_t>{}(gen);
+        }
+        template<typename Gen, std::size_t Bits>
+        std::uint32_t random_u32_(Gen & gen, meta::size_t<Bits>)
+        {
+            return static_cast<std::uint32_t>(gen());
+        }
+        // 32 uniformly random bits from gen
+        template<typename Gen>
+        std::uint32_t random_u32(Gen & gen)
+        {
+            return detail::random_u32_(gen, urbg_bits_<Gen>{});
+        }
+
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen, meta::size_t<0>)
+        {
+            return std::uniform_int_distribution<std::uint64_t>{}(gen);
+        }
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen, meta::size_t<32>)
+        {
+            std::uint64_t const hi = static_cast<std::uint32_t>(gen());
+            return (hi << 32) | static_cast<std::uint32_t>(gen());
+        }
+        template<typename Gen>
+        std::uint64_t random_u64_(Gen & gen, meta::size_t<64>)
+        {
+            return static_cast<std::uint64_t>(gen());
+        }
+        // 64 uniformly random bits from gen
+        template<typename Gen>
+        std::uint64_t random_u64(Gen & gen)
+        {
+            return detail::random_u64_(gen, urbg_bits_<Gen>{});
+        }
+
+        // The low half of the full product of a and b, the high half in hi.
+        inline std::uint64_t mul_u64_(std::uint64_t a, std::uint64_t b,
+                                      std::uint64_t & hi) noexcept
+        {
+#ifdef __SIZEOF_INT128__
+            __extension__ using u128 = unsigned __int128;
+            auto const m = static_cast<u128>(a) * b;
+            hi = static_cast<std::uint64_t>(m >> 64);
+            return static_cast<std::uint64_t>(m);
+#else
+            std::uint64_t const a0 = a & 0xffffffffu, a1 = a >> 32;
+            std::uint64_t const b0 = b & 0xffffffffu, b1 = b >> 32;
+            std::uint64_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+            std::uint64_t const mid = (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+            hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+            return (mid << 32) | (p00 & 0xffffffffu);
+#endif
+        }
+
+        // A uniformly random integer in [0, bound), for bound > 0, by Lemire's
+        // nearly divisionless method ("Fast Random Integer Generation in an
+        // Interval", 2019). The high half of bound times a random word is
+        // uniform once the products whose low half is below 2^w mod bound are
+        // rejected, and that remainder is only computed, with a division,
+        // when the low half is below bound, which is rare for small bounds.
+        template<typename Gen>
+        std::uint64_t bounded_random(Gen & gen, std::uint64_t bound)
+        {
+            if(bound <= UINT32_MAX)
+            {
+                auto const b = static_cast<std::uint32_t>(bound);
+                std::uint64_t m = std::uint64_t{detail::random_u32(gen)} * b;
+                if(static_cast<std::uint32_t>(m) < b)
+                {
+                    std::uint32_t const t = static_cast<std::uint32_t>(0u - b) % b;
+                    while(static_cast<std::uint32_t>(m) < t)
+                        m = std::uint64_t{detail::random_u32(gen)} * b;
+                }
+                return m >> 32;
+            }
+            std::uint64_t hi;
+            std::uint64_t lo = detail::mul_u64_(detail::random_u64(gen), bound, hi);
+            if(lo < bound)
+            {
+                std::uint64_t const t = (0u - bound) % bound;
+                while(lo < t)
+                    lo = detail::mul_u64_(detail::random_u64(gen), bound, hi);
+            }
+            return hi;
+        }
+
+        // Uniformly random integers in [0, bound0) and [0, bound1) from a
+        // single random word, for bound0 * bound1 < 2^64, after
+        // Brackett-Rozinsky and Lemire ("Batched Ranged Random Integer
+        // Generation", 2024): the word is read as a number in mixed radix.
+        template<typename Gen>
+        std::pair<std::uint64_t, std::uint64_t> bounded_random_2(
+            Gen & gen, std::uint64_t bound0, std::uint64_t bound1)
+        {
+            std::uint64_t const product = bound0 * bound1;
+            std::uint64_t r0, r1;
+            std::uint64_t lo = detail::mul_u64_(detail::random_u64(gen), bound0, r0);
+            lo = detail::mul_u64_(lo, bound1, r1);
+            if(lo < product)
+            {
+                std::uint64_t const t = (0u - product) % product;
+                while(lo < t)
+                {
+                    lo = detail::mul_u64_(detail::random_u64(gen), bound0, r0);
+                    lo = detail::mul_u64_(lo, bound1, r1);
+                }
+            }
+            return {r0, r1};
+        }
+
+        // A uniformly random double in (0, 1)
+        template<typename Gen>
+        double random_unit(Gen & gen)
+        {
+            return (static_cast<double>(detail::random_u64(gen) >> 11) + 0.5) *
+                   (1.0 / 9007199254740992.0);
+        }
     } // namespace detail
     /// \endcond
 } // namespace ranges
@@ -0,0 +1,541 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_THREAD_POOL_HPP
+#define RANGES_V3_UTILITY_THREAD_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/utility/optional.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        inline unsigned hardware_concurrency() noexcept
+        {
+            unsigned const n = std::thread::hardware_concurrency();
+            return n == 0u ? 1u : n;
+        }
+
+        struct pool_task
+        {
+            virtual void execute() noexcept = 0;
+
+        protected:
+            ~pool_task() = default;
+        };
+
+        // The lock-free work-stealing deque of Chase and Lev ("Dynamic
+        // Circular Work-Stealing Deque", SPAA 2005), with the memory orderings
+        // of Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory
+        // Models", PPoPP 2013). Only the owning thread may push and pop, at the
+        // bottom; any thread may steal, from the top.
+        class work_stealing_deque
+        {
+            struct ring
+            {
+                std::int64_t mask;
+                std::unique_ptr<std::atomic<pool_task *>[]> slots;
+
+                explicit ring(std::int64_t capacity)
+                  : mask(capacity - 1)
+                  , slots(new std::atomic<pool_task *>[static_cast<std::size_t>(capacity)])
+                {}
+                std::int64_t capacity() const noexcept
+                {
+                    return mask + 1;
+                }
+                pool_task * get(std::int64_t i) const noexcept
+                {
+                    return slots[static_cast<std::size_t>(i & mask)].load(
+                        std::memory_order_relaxed);
+                }
+                void put(std::int64_t i, pool_task * t) noexcept
+                {
+                    slots[static_cast<std::size_t>(i & mask)].store(
+                        t, std::memory_order_relaxed);
+                }
+            };
+
+            std::atomic<std::int64_t> top_{0};
+            std::atomic<std::int64_t> bottom_{0};
+            std::atomic<ring *> ring_;
+            // Rings that have been outgrown. A thief may still be reading one,
+            // so they live as long as the deque.
+            std::vector<std::unique_ptr<ring>> rings_;
+
+        public:
+            work_stealing_deque()
+            {
+                rings_.emplace_back(new ring{64});
+                ring_.store(rings_.back().get(), std::memory_order_relaxed);
+            }
+            work_stealing_deque(work_stealing_deque const &) = delete;
+            work_stealing_deque & operator=(work_stealing_deque const &) = delete;
+
+            void push(pool_task * t)
+            {
+                std::int64_t const b = bottom_.load(std::memory_order_relaxed);
+                std::int64_t const tp = top_.load(std::memory_order_acquire);
+                ring * r = ring_.load(std::memory_order_relaxed);
+                if(b - tp > r->capacity() - 1)
+                {
+                    rings_.emplace_back(new ring{r->capacity() * 2});
+                    ring * bigger = rings_.back().get();
+                    for(std::int64_t i = tp; i != b; ++i)
+                        bigger->put(i, r->get(i));
+                    ring_.store(bigger, std::memory_order_release);
+                    r = bigger;
+                }
+                r->put(b, t);
+                std::atomic_thread_fence(std::memory_order_release);
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+
+            pool_task * pop() noexcept
+            {
+                std::int64_t const b = bottom_.load(std::memory_order_relaxed) - 1;
+                ring * r = ring_.load(std::memory_order_relaxed);
+                bottom_.store(b, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t tp = top_.load(std::memory_order_relaxed);
+                pool_task * t = nullptr;
+                if(tp <= b)
+                {
+                    t = r->get(b);
+                    if(tp == b)
+                    {
+                        // The last task: race the thieves for it.
+                        if(!top_.compare_exchange_strong(tp,
+                                                         tp + 1,
+                                                         std::memory_order_seq_cst,
+                                                         std::memory_order_relaxed))
+                            t = nullptr;
+                        bottom_.store(b + 1, std::memory_order_relaxed);
+                    }
+                }
+                else
+                    bottom_.store(b + 1, std::memory_order_relaxed);
+                return t;
+            }
+
+            pool_task * steal() noexcept
+            {
+                std::int64_t tp = top_.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t const b = bottom_.load(std::memory_order_acquire);
+                if(tp >= b)
+                    return nullptr;
+                pool_task * t = ring_.load(std::memory_order_acquire)->get(tp);
+                if(!top_.compare_exchange_strong(
+                       tp, tp + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return nullptr;
+                return t;
+            }
+        };
+
+        template<typename F>
+        struct join_task final : pool_task
+        {
+            F & fun;
+            std::exception_ptr error;
+            std::atomic<bool> done{false};
+
+            explicit join_task(F & f)
+              : fun(f)
+            {}
+            void execute() noexcept override
+            {
+                try
+                {
+                    fun();
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                }
+                done.store(true, std::memory_order_release);
+            }
+        };
+
+        template<typename F>
+        struct posted_task final : pool_task
+        {
+            F fun;
+
+            explicit posted_task(F f)
+              : fun(std::move(f))
+            {}
+            void execute() noexcept override
+            {
+                std::unique_ptr<posted_task> self{this};
+                fun();
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// A pool of worker threads that schedules tasks by work stealing. Each
+    /// worker keeps the tasks it creates in its own deque and, when that runs
+    /// dry, takes the oldest task of another worker. Tasks created by threads
+    /// outside the pool go to a shared queue.
+    ///
+    /// Threads that wait for a task to finish run other tasks in the meantime,
+    /// so a pool with no workers at all is valid: everything then runs on the
+    /// threads that call \c fork_join and \c run.
+    class thread_pool
+    {
+        struct worker
+        {
+            detail::work_stealing_deque tasks;
+            std::thread thread;
+        };
+
+        std::vector<std::unique_ptr<worker>> workers_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::deque<detail::pool_task *> shared_; // guarded by mutex_
+        std::atomic<std::size_t> shared_size_{0};
+        std::atomic<std::uint64_t> epoch_{0};
+        std::atomic<std::size_t> sleepers_{0};
+        bool stop_ = false; // guarded by mutex_
+
+        struct thread_state
+        {
+            thread_pool * pool = nullptr;  // the pool whose task is running
+            thread_pool * owner = nullptr; // the pool the thread works for
+            worker * self = nullptr;
+            std::uint32_t seed = 0x9e3779b9u;
+        };
+
+        static thread_state & state() noexcept
+        {
+            static thread_local thread_state st;
+            return st;
+        }
+
+        // Makes *this the pool of the calling thread while a task of it runs.
+        struct enter
+        {
+            thread_pool * prev;
+
+            explicit enter(thread_pool * p) noexcept
+              : prev(state().pool)
+            {
+                state().pool = p;
+            }
+            ~enter()
+            {
+                state().pool = prev;
+            }
+        };
+
+        worker * self() noexcept
+        {
+            auto & st = state();
+            return st.owner == this ? st.self : nullptr;
+        }
+
+        void push(detail::pool_task * t)
+        {
+            if(worker * w = self())
+                w->tasks.push(t);
+            else
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                shared_.push_back(t);
+                shared_size_.fetch_add(1);
+            }
+            epoch_.fetch_add(1);
+            if(sleepers_.load() != 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                }
+                wake_.notify_one();
+            }
+        }
+
+        detail::pool_task * take_shared()
+        {
+            if(shared_size_.load(std::memory_order_relaxed) == 0)
+                return nullptr;
+            std::lock_guard<std::mutex> lock{mutex_};
+            if(shared_.empty())
+                return nullptr;
+            detail::pool_task * t = shared_.front();
+            shared_.pop_front();
+            shared_size_.fetch_sub(1);
+            return t;
+        }
+
+        // Finds a task to run: one of the caller's own, else one stolen from a
+        // random worker, else one from the shared queue.
+        detail::pool_task * find_task()
+        {
+            worker * me = self();
+            if(me)
+                if(detail::pool_task * t = me->tasks.pop())
+                    return t;
+            std::size_t const n = workers_.size();
+            if(n != 0)
+            {
+                auto & seed = state().seed;
+                seed ^= seed << 13;
+                seed ^= seed >> 17;
+                seed ^= seed << 5;
+                std::size_t const start = seed % n;
+                for(std::size_t i = 0; i != n; ++i)
+                {
+                    worker * victim = workers_[(start + i) % n].get();
+                    if(victim == me)
+                        continue;
+                    if(detail::pool_task * t = victim->tasks.steal())
+                        return t;
+                }
+            }
+            return take_shared();
+        }
+
+        void execute(detail::pool_task * t)
+        {
+            enter e{this};
+            t->execute();
+        }
+
+        void work(worker * me, std::size_t index)
+        {
+            auto & st = state();
+            st.pool = this;
+            st.owner = this;
+            st.self = me;
+            st.seed = static_cast<std::uint32_t>(index * 2654435761u + 1u);
+            while(true)
+            {
+                std::uint64_t const seen = epoch_.load();
+                if(detail::pool_task * t = find_task())
+                {
+                    t->execute();
+                    continue;
+                }
+                sleepers_.fetch_add(1);
+                {
+                    std::unique_lock<std::mutex> lock{mutex_};
+                    while(!stop_ && epoch_.load() == seen)
+                        wake_.wait(lock);
+                    if(stop_ && shared_.empty())
+                    {
+                        sleepers_.fetch_sub(1);
+                        return;
+                    }
+                }
+                sleepers_.fetch_sub(1);
+            }
+        }
+
+        // Runs other tasks until done is set. When there are none, yields for
+        // a while and then naps, for longer each time up to a quarter of a
+        // millisecond, waking early when a task is pushed.
+        void help_until(std::atomic<bool> const & done)
+        {
+            int idle = 0;
+            std::chrono::microseconds nap{1};
+            while(!done.load(std::memory_order_acquire))
+            {
+                std::uint64_t const seen = epoch_.load();
+                if(detail::pool_task * t = find_task())
+                {
+                    execute(t);
+                    idle = 0;
+                    nap = std::chrono::microseconds{1};
+                    continue;
+                }
+                if(++idle < 64)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                sleepers_.fetch_add(1);
+                {
+                    std::unique_lock<std::mutex> lock{mutex_};
+                    if(epoch_.load() == seen && !done.load(std::memory_order_acquire))
+                        wake_.wait_for(lock, nap);
+                }
+                sleepers_.fetch_sub(1);
+                if(nap < std::chrono::microseconds{256})
+                    nap *= 2;
+            }
+        }
+
+    public:
+        /// The number of workers a default-constructed pool has: one fewer
+        /// than the number of hardware threads, since the thread that waits for
+        /// the pool's work helps to do it.
+        static std::size_t default_size() noexcept
+        {
+            return detail::hardware_concurrency() - 1u;
+        }
+
+        /// Starts \c threads worker threads.
+        explicit thread_pool(std::size_t threads = default_size())
+        {
+            workers_.reserve(threads);
+            for(std::size_t i = 0; i != threads; ++i)
+                workers_.emplace_back(new worker);
+            for(std::size_t i = 0; i != threads; ++i)
+                workers_[i]->thread =
+                    std::thread{&thread_pool::work, this, workers_[i].get(), i};
+        }
+
+        thread_pool(thread_pool const &) = delete;
+        thread_pool & operator=(thread_pool const &) = delete;
+
+        /// Runs the tasks still queued, then stops the workers.
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for(auto & w : workers_)
+                w->thread.join();
+        }
+
+        /// The number of worker threads.
+        std::size_t size() const noexcept
+        {
+            return workers_.size();
+        }
+
+        /// Evaluates \c f() and \c g() concurrently, \c f() as a task of the
+        /// pool and \c g() on the calling thread, and returns when both are
+        /// done. An exception thrown by either is rethrown once both have
+        /// finished.
+        template<typename F, typename G>
+        void fork_join(F && f, G && g)
+        {
+            detail::join_task<F> task{f};
+            push(&task);
+            std::exception_ptr error;
+            try
+            {
+                static_cast<G &&>(g)();
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+            // Nothing g() forked is still in the deque, so if f() has not been
+            // stolen it is on top.
+            worker * me = self();
+            if(me && !task.done.load(std::memory_order_acquire))
+            {
+                if(detail::pool_task * t = me->tasks.pop())
+                {
+                    RANGES_EXPECT(t == &task);
+                    t->execute();
+                }
+            }
+            help_until(task.done);
+            if(!error)
+                error = task.error;
+            if(error)
+                std::rethrow_exception(error);
+        }
+
+        /// Evaluates \c f() as a task of the pool and returns its result when
+        /// it is done. Parallel algorithms called from \c f() run on this pool.
+        template<typename F>
+        auto run(F && f) -> decltype(static_cast<F &&>(f)())
+        {
+            using R = decltype(static_cast<F &&>(f)());
+            return run_(static_cast<F &&>(f), meta::bool_<RANGES_IS_SAME(R, void)>{});
+        }
+
+        /// Queues \c f() to be evaluated by the pool and returns without waiting
+        /// for it. \c f() must not throw.
+        template<typename F>
+        void post(F f)
+        {
+            push(new detail::posted_task<F>{std::move(f)});
+        }
+
+        /// The pool that parallel algorithms run on: the pool of the calling
+        /// thread if it is running a task of one, and the default pool
+        /// otherwise.
+        static thread_pool & current()
+        {
+            thread_pool * p = state().pool;
+            return p ? *p : default_pool();
+        }
+
+        /// A pool of \c default_size() workers, started on first use, for the
+        /// parallel algorithms and any code that wants to share it.
+        static thread_pool & default_pool()
+        {
+            static thread_pool pool;
+            return pool;
+        }
+
+    private:
+        template<typename F>
+        void run_(F && f, std::true_type)
+        {
+            fork_join(static_cast<F &&>(f), [] {});
+        }
+        template<typename F>
+        auto run_(F && f, std::false_type) -> decltype(static_cast<F &&>(f)())
+        {
+            using R = decltype(static_cast<F &&>(f)());
+            // optional holds lvalue references but not rvalue ones, so those
+            // are kept as lvalue references and cast back on the way out.
+            using S = meta::if_c<std::is_rvalue_reference<R>::value,
+                                 meta::_t<std::remove_reference<R>> &, R>;
+            optional<S> result;
+            fork_join(
+                [&] {
+                    auto && r = static_cast<F &&>(f)();
+                    result.emplace(static_cast<S &&>(r));
+                },
+                [] {});
+            return static_cast<R>(*std::move(result));
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -20,6 +20,7 @@
 #include <range/v3/view/adjacent_remove_if.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/any_view.hpp>
+#include <range/v3/view/buffered_istream.hpp>
 #include <range/v3/view/c_str.hpp>
 #include <range/v3/view/cache1.hpp>
 #include <range/v3/view/cartesian_product.hpp>
@@ -51,8 +52,11 @@
 #include <range/v3/view/istream.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/linear_distribute.hpp>
+#include <range/v3/view/lines.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/merge_all.hpp>
 #include <range/v3/view/move.hpp>
+#include <range/v3/view/par.hpp>
 #include <range/v3/view/partial_sum.hpp>
 #include <range/v3/view/ref.hpp>
 #include <range/v3/view/remove.hpp>
@@ -15,6 +15,8 @@
 #ifndef RANGES_V3_VIEW_ANY_VIEW_HPP
 #define RANGES_V3_VIEW_ANY_VIEW_HPP
 
+#include <cstddef>
+#include <new>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
@@ -32,6 +34,15 @@
 
 #include <range/v3/detail/prologue.hpp>
 
+/// \def RANGES_ANY_VIEW_CURSOR_BUFFER_SIZE
+/// The number of bytes of inline storage in the iterators of \c any_view. Type
+/// erased cursors that fit in it, such as those over pointers or integers, are
+/// stored in the iterator instead of on the heap, so that creating and copying
+/// the iterator never allocates.
+#ifndef RANGES_ANY_VIEW_CURSOR_BUFFER_SIZE
+#define RANGES_ANY_VIEW_CURSOR_BUFFER_SIZE (3 * sizeof(void *))
+#endif
+
 RANGES_DIAGNOSTIC_PUSH
 RANGES_DIAGNOSTIC_IGNORE_INCONSISTENT_OVERRIDE
 RANGES_DIAGNOSTIC_SUGGEST_OVERRIDE
@@ -154,6 +165,116 @@ namespace ranges
             virtual std::unique_ptr<cloneable> clone() const = 0;
         };
 
+        // Like cloneable, but the clone is constructed in caller-provided
+        // storage if it fits there. See any_cursor.
+        template<typename Base>
+        struct inline_cloneable : Base
+        {
+            using Base::Base;
+            virtual ~inline_cloneable() override = default;
+            inline_cloneable() = default;
+            inline_cloneable(inline_cloneable const &) = delete;
+            inline_cloneable & operator=(inline_cloneable const &) = delete;
+            // Copy *this into the any_cursor_buffer at buf if it fits there,
+            // or into a new heap allocation if not. Returns the copy.
+            virtual inline_cloneable * clone_into(void * buf) const = 0;
+            // Move *this, which is stored inline, into the any_cursor_buffer
+            // at buf. Returns the new object.
+            virtual inline_cloneable * move_into(void * buf) noexcept = 0;
+        };
+
+        using any_cursor_buffer =
+            meta::_t<std::aligned_storage<RANGES_ANY_VIEW_CURSOR_BUFFER_SIZE,
+                                          alignof(void *)>>;
+
+        // Whether a Cursor wrapping an I can be stored in an any_cursor_buffer.
+        // It must be relocatable without throwing, since any_cursor's move
+        // operations do so.
+        template<typename Cursor, typename I>
+        RANGES_INLINE_VAR constexpr bool fits_any_cursor_buffer_v =
+            sizeof(Cursor) <= sizeof(any_cursor_buffer) &&
+            alignof(Cursor) <= alignof(any_cursor_buffer) &&
+            std::is_nothrow_move_constructible<I>::value;
+
+        // Blocks of elements read out of an any_view in one virtual call are
+        // buffered by address if Ref is a reference type, and by value if not.
+        template<typename Ref>
+        using any_chunk_elem_t = meta::if_c<std::is_reference<Ref>::value,
+                                            meta::_t<std::remove_reference<Ref>> *, Ref>;
+
+        template<typename Ref>
+        RANGES_INLINE_VAR constexpr bool any_chunk_bufferable_v =
+            std::is_reference<Ref>::value ||
+            (std::is_default_constructible<Ref>::value &&
+             std::is_move_assignable<Ref>::value);
+
+        // Whether the elements of an I can be buffered as any_chunk_elem_ts.
+        // Buffering by address requires that converting the iterator's
+        // reference to Ref does not create a temporary.
+        template<typename Ref, typename I>
+        RANGES_INLINE_VAR constexpr bool any_chunk_readable_v =
+            std::is_reference<Ref>::value
+                ? std::is_reference<iter_reference_t<I>>::value &&
+                      std::is_convertible<
+                          meta::_t<std::remove_reference<iter_reference_t<I>>> *,
+                          meta::_t<std::remove_reference<Ref>> *>::value
+                : any_chunk_bufferable_v<Ref>;
+
+        // The pointer through which a contiguous erased range is walked: to
+        // the referred-to type if Ref is a reference, from which each element
+        // is converted to Ref as it is visited if not.
+        template<typename Ref>
+        using any_chunk_pointer_t =
+            meta::if_c<std::is_reference<Ref>::value, meta::_t<std::remove_reference<Ref>> *,
+                       uncvref_t<Ref> const *>;
+
+        // Whether the elements of an I can be handed out as a pointer and a
+        // length.
+        template<typename Ref, typename I>
+        RANGES_INLINE_VAR constexpr bool any_chunk_contiguous_v =
+            contiguous_iterator<I> && RANGES_IS_SAME(uncvref_t<Ref>, iter_value_t<I>) &&
+            (std::is_reference<Ref>::value
+                 ? any_chunk_readable_v<Ref, I>
+                 : std::is_lvalue_reference<iter_reference_t<I>>::value);
+
+        template<typename Elem, typename I>
+        void any_chunk_put_(Elem & elem, I & it, std::true_type)
+        {
+            auto && ref = *it;
+            elem = detail::addressof(ref);
+        }
+        template<typename Elem, typename I>
+        void any_chunk_put_(Elem & elem, I & it, std::false_type)
+        {
+            elem = *it;
+        }
+        template<typename Ref, typename I>
+        void any_chunk_put(any_chunk_elem_t<Ref> & elem, I & it)
+        {
+            detail::any_chunk_put_(elem, it, std::is_reference<Ref>{});
+        }
+
+        template<typename Ref, typename Elem>
+        Ref any_chunk_get_(Elem & elem, std::true_type)
+        {
+            return static_cast<Ref>(*elem);
+        }
+        template<typename Ref, typename Elem>
+        Ref any_chunk_get_(Elem & elem, std::false_type)
+        {
+            return static_cast<Ref>(std::move(elem));
+        }
+        template<typename Ref>
+        Ref any_chunk_get(any_chunk_elem_t<Ref> & elem)
+        {
+            return detail::any_chunk_get_<Ref>(elem, std::is_reference<Ref>{});
+        }
+
+        constexpr std::ptrdiff_t any_chunk_size()
+        {
+            return 64;
+        }
+
         // clang-format off
         template(typename Rng, typename Ref)(
         concept (any_compatible_range_)(Rng, Ref),
@@ -322,7 +443,8 @@ namespace ranges
         };
 
         template<typename Ref, category Cat>
-        using any_cloneable_cursor_interface = cloneable<any_cursor_interface<Ref, Cat>>;
+        using any_cloneable_cursor_interface =
+            inline_cloneable<any_cursor_interface<Ref, Cat>>;
 
         template<typename I, typename Ref, category Cat>
         struct any_cursor_impl : any_cloneable_cursor_interface<Ref, Cat>
@@ -335,12 +457,36 @@ namespace ranges
               : it_{std::move(it)}
             {}
 
+            // Construct an any_cursor_impl in the any_cursor_buffer at buf if it
+            // fits there, or on the heap if not.
+            static any_cloneable_cursor_interface<Ref, Cat> * create(void * buf, I it)
+            {
+                return any_cursor_impl::create_(
+                    buf,
+                    std::move(it),
+                    meta::bool_<fits_any_cursor_buffer_v<any_cursor_impl, I>>{});
+            }
+
         private:
+            template<typename, typename, category>
+            friend struct any_view_impl;
+
             using Forward =
                 any_cursor_interface<Ref, (Cat & ~category::mask) | category::forward>;
 
             I it_;
 
+            static any_cloneable_cursor_interface<Ref, Cat> * create_(void * buf, I it,
+                                                                      std::true_type)
+            {
+                return ::new(buf) any_cursor_impl(std::move(it));
+            }
+            static any_cloneable_cursor_interface<Ref, Cat> * create_(void *, I it,
+                                                                      std::false_type)
+            {
+                return new any_cursor_impl(std::move(it));
+            }
+
             any_ref iter() const override
             {
                 return it_;
@@ -358,10 +504,15 @@ namespace ranges
             {
                 ++it_;
             }
-            std::unique_ptr<any_cloneable_cursor_interface<Ref, Cat>> clone()
-                const override
+            any_cloneable_cursor_interface<Ref, Cat> * clone_into(
+                void * buf) const override
+            {
+                return any_cursor_impl::create(buf, it_);
+            }
+            any_cloneable_cursor_interface<Ref, Cat> * move_into(
+                void * buf) noexcept override
             {
-                return detail::make_unique<any_cursor_impl>(it_);
+                return ::new(buf) any_cursor_impl(std::move(it_));
             }
             void prev() // override (sometimes; it's complicated)
             {
@@ -402,17 +553,53 @@ namespace ranges
             fully_erased_view * view_ = nullptr;
         };
 
+        // A type-erased cursor. Cursors small enough to fit in an
+        // any_cursor_buffer are stored inline; larger ones live on the heap.
         template<typename Ref, category Cat>
         struct any_cursor
         {
         private:
             CPP_assert((Cat & category::forward) == category::forward);
 
-            std::unique_ptr<any_cloneable_cursor_interface<Ref, Cat>> ptr_;
+            template<typename, typename, category>
+            friend struct any_view_impl;
+
+            using interface_t = any_cloneable_cursor_interface<Ref, Cat>;
+
+            any_cursor_buffer buf_;
+            interface_t * ptr_ = nullptr;
 
             template<typename Rng>
             using impl_t = any_cursor_impl<iterator_t<Rng>, Ref, Cat>;
 
+            bool is_inline() const noexcept
+            {
+                return static_cast<void const *>(ptr_) ==
+                       static_cast<void const *>(&buf_);
+            }
+            void reset() noexcept
+            {
+                if(is_inline())
+                    ptr_->~interface_t();
+                else
+                    delete ptr_;
+                ptr_ = nullptr;
+            }
+            void steal(any_cursor & that) noexcept
+            {
+                RANGES_EXPECT(!ptr_);
+                if(that.is_inline())
+                {
+                    ptr_ = that.ptr_->move_into(&buf_);
+                    that.reset();
+                }
+                else
+                {
+                    ptr_ = that.ptr_;
+                    that.ptr_ = nullptr;
+                }
+            }
+
         public:
             any_cursor() = default;
             template(typename Rng)(
@@ -421,16 +608,32 @@ namespace ranges
                     forward_range<Rng> AND
                     any_compatible_range<Rng, Ref>)
             explicit any_cursor(Rng && rng)
-              : ptr_{detail::make_unique<impl_t<Rng>>(begin(rng))}
+              : ptr_{impl_t<Rng>::create(&buf_, begin(rng))}
             {}
-            any_cursor(any_cursor &&) = default;
+            any_cursor(any_cursor && that) noexcept
+            {
+                steal(that);
+            }
             any_cursor(any_cursor const & that)
-              : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
+              : ptr_{that.ptr_ ? that.ptr_->clone_into(&buf_) : nullptr}
             {}
-            any_cursor & operator=(any_cursor &&) = default;
+            ~any_cursor()
+            {
+                reset();
+            }
+            any_cursor & operator=(any_cursor && that) noexcept
+            {
+                if(this != &that)
+                {
+                    reset();
+                    steal(that);
+                }
+                return *this;
+            }
             any_cursor & operator=(any_cursor const & that)
             {
-                ptr_ = (that.ptr_ ? that.ptr_->clone() : nullptr);
+                if(this != &that)
+                    *this = any_cursor(that);
                 return *this;
             }
             Ref read() const
@@ -490,6 +693,18 @@ namespace ranges
 
             virtual ~any_view_interface() = default;
             virtual any_cursor<Ref, Cat> begin_cursor() = 0;
+            // Read up to n elements, starting at cur, into buf and advance cur
+            // past them. Returns the number read, which is less than n only at
+            // the end of the range, or -1 if the elements cannot be buffered.
+            virtual std::ptrdiff_t read_chunk(any_cursor<Ref, Cat> & cur,
+                                              any_chunk_elem_t<Ref> * buf,
+                                              std::ptrdiff_t n) = 0;
+            // If the elements from cur to the end of the range are contiguous in
+            // memory, point first at them, set n to their number, advance cur to
+            // the end and return true. Otherwise, return false.
+            virtual bool contiguous_chunk(any_cursor<Ref, Cat> & cur,
+                                          any_chunk_pointer_t<Ref> & first,
+                                          std::ptrdiff_t & n) = 0;
         };
         template<typename Ref, category Cat>
         struct any_view_interface<Ref, Cat, true> : any_view_interface<Ref, Cat, false>
@@ -521,11 +736,69 @@ namespace ranges
         private:
             using range_box_t = box<Rng, any_view_impl>;
             using sentinel_box_t = any_view_sentinel_impl<Rng>;
+            using cursor_impl_t = any_cursor_impl<iterator_t<Rng>, Ref, Cat>;
+            using pointer_t = any_chunk_pointer_t<Ref>;
+
+            static iterator_t<Rng> & iter(any_cursor<Ref, Cat> & cur) noexcept
+            {
+                RANGES_EXPECT(cur.ptr_);
+                return polymorphic_downcast<cursor_impl_t &>(*cur.ptr_).it_;
+            }
 
             any_cursor<Ref, Cat> begin_cursor() override
             {
                 return any_cursor<Ref, Cat>{range_box_t::get()};
             }
+            std::ptrdiff_t read_chunk(any_cursor<Ref, Cat> & cur,
+                                      any_chunk_elem_t<Ref> * buf,
+                                      std::ptrdiff_t n) override
+            {
+                return read_chunk_(
+                    cur, buf, n, meta::bool_<any_chunk_readable_v<Ref, iterator_t<Rng>>>{});
+            }
+            std::ptrdiff_t read_chunk_(any_cursor<Ref, Cat> & cur,
+                                       any_chunk_elem_t<Ref> * buf, std::ptrdiff_t n,
+                                       std::true_type)
+            {
+                auto & it = iter(cur);
+                auto && last = sentinel_box_t::get(range_box_t::get());
+                std::ptrdiff_t i = 0;
+                for(; i < n && it != last; ++i, ++it)
+                    detail::any_chunk_put<Ref>(buf[i], it);
+                return i;
+            }
+            std::ptrdiff_t read_chunk_(any_cursor<Ref, Cat> &, any_chunk_elem_t<Ref> *,
+                                       std::ptrdiff_t, std::false_type)
+            {
+                return -1;
+            }
+            bool contiguous_chunk(any_cursor<Ref, Cat> & cur, pointer_t & first,
+                                  std::ptrdiff_t & n) override
+            {
+                return contiguous_chunk_(
+                    cur, first, n,
+                    meta::bool_<any_chunk_contiguous_v<Ref, iterator_t<Rng>> &&
+                                sized_sentinel_for<sentinel_t<Rng>, iterator_t<Rng>>>{});
+            }
+            bool contiguous_chunk_(any_cursor<Ref, Cat> & cur, pointer_t & first,
+                                   std::ptrdiff_t & n, std::true_type)
+            {
+                auto & it = iter(cur);
+                auto && last = sentinel_box_t::get(range_box_t::get());
+                n = static_cast<std::ptrdiff_t>(last - it);
+                if(n > 0)
+                {
+                    auto && ref = *it;
+                    first = detail::addressof(ref);
+                    it += n;
+                }
+                return true;
+            }
+            bool contiguous_chunk_(any_cursor<Ref, Cat> &, pointer_t &, std::ptrdiff_t &,
+                                   std::false_type)
+            {
+                return false;
+            }
             bool at_end(any_ref it_) override
             {
                 auto & it = it_.get<iterator_t<Rng> const>();
@@ -545,6 +818,11 @@ namespace ranges
 
     /// \brief A type-erased view
     /// \ingroup group-views
+    ///
+    /// \c ranges::for_each, \c ranges::accumulate and \c ranges::to walk a
+    /// contiguous erased range through a pointer, with one indirect call in
+    /// all. \c ranges::for_each_buffered also reads other forward erased
+    /// ranges in blocks of up to 64 elements, one indirect call per block.
     template<typename Ref, category Cat = category::input, typename enable = void>
     struct any_view
       : view_facade<any_view<Ref, Cat>,
@@ -587,6 +865,79 @@ namespace ranges
     private:
         template<typename Rng>
         using impl_t = detail::any_view_impl<views::all_t<Rng>, Ref, Cat>;
+        using cursor_t = detail::any_cursor<Ref, Cat>;
+        using iterator_t_ = basic_iterator<cursor_t>;
+
+        // Invoke f on each element and return the end iterator. A contiguous
+        // erased range is walked through a pointer, which reads each element
+        // when f is called on it, as iterating would. Algorithms reach this
+        // through range_access; see detail/chunked.hpp.
+        template<typename F>
+        iterator_t_ for_each_chunked(F & f)
+        {
+            cursor_t cur = begin_cursor();
+            if(ptr_)
+                for_each_chunked_(cur,
+                                  f,
+                                  meta::bool_<detail::any_chunk_bufferable_v<Ref>>{},
+                                  std::false_type{});
+            return iterator_t_{std::move(cur)};
+        }
+        // As for_each_chunked, but other erased ranges are read out in blocks,
+        // so that the cost of the indirect calls is spread over many elements.
+        // Each block is read before f sees its first element. Only
+        // ranges::for_each_buffered calls this.
+        template<typename F>
+        iterator_t_ for_each_buffered(F & f)
+        {
+            cursor_t cur = begin_cursor();
+            if(ptr_)
+                for_each_chunked_(cur,
+                                  f,
+                                  meta::bool_<detail::any_chunk_bufferable_v<Ref>>{},
+                                  std::true_type{});
+            return iterator_t_{std::move(cur)};
+        }
+        template<typename F, typename ReadAhead>
+        void for_each_chunked_(cursor_t & cur, F & f, std::true_type, ReadAhead)
+        {
+            detail::any_chunk_pointer_t<Ref> first = nullptr;
+            std::ptrdiff_t n = 0;
+            if(ptr_->contiguous_chunk(cur, first, n))
+            {
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    f(static_cast<Ref>(first[i]));
+                return;
+            }
+            for_each_buffered_(cur, f, ReadAhead{});
+        }
+        template<typename F, typename ReadAhead>
+        void for_each_chunked_(cursor_t & cur, F & f, std::false_type, ReadAhead)
+        {
+            for_each_buffered_(cur, f, std::false_type{});
+        }
+        template<typename F>
+        void for_each_buffered_(cursor_t & cur, F & f, std::true_type)
+        {
+            std::ptrdiff_t n = 0;
+            constexpr std::ptrdiff_t size = detail::any_chunk_size();
+            detail::any_chunk_elem_t<Ref> buf[size];
+            while((n = ptr_->read_chunk(cur, buf, size)) >= 0)
+            {
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    f(detail::any_chunk_get<Ref>(buf[i]));
+                if(n < size)
+                    return;
+            }
+            for_each_buffered_(cur, f, std::false_type{});
+        }
+        template<typename F>
+        void for_each_buffered_(cursor_t & cur, F & f, std::false_type)
+        {
+            for(auto const last = end_cursor(); !cur.equal(last); cur.next())
+                f(cur.read());
+        }
+
         template<typename Rng>
         any_view(Rng && rng, std::true_type)
           : ptr_{detail::make_unique<impl_t<Rng>>(views::all(static_cast<Rng &&>(rng)))}
@@ -605,7 +956,7 @@ namespace ranges
         }
         detail::any_sentinel end_cursor() noexcept
         {
-            return detail::any_sentinel{*ptr_};
+            return ptr_ ? detail::any_sentinel{*ptr_} : detail::any_sentinel{};
         }
 
         std::unique_ptr<detail::any_cloneable_view_interface<Ref, Cat>> ptr_;
@@ -0,0 +1,628 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_BUFFERED_ISTREAM_HPP
+#define RANGES_V3_VIEW_BUFFERED_ISTREAM_HPP
+
+#include <cerrno>
+#include <clocale>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/subrange.hpp>
+
+// <charconv> defines __cpp_lib_to_chars when from_chars parses floating-point
+// numbers. It is included whenever it exists, so that which parser is used
+// does not depend on the headers included before this one.
+#if RANGES_CXX_STD >= RANGES_CXX_STD_17 && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Reads an istream a block at a time, straight from its streambuf,
+        // keeping the bytes not yet consumed at the front of the buffer. A
+        // '\0' always follows the buffered bytes.
+        class istream_buffer
+        {
+            std::istream * sin_ = nullptr;
+            bool more_ = false; // whether there may be more input
+            std::vector<char> buf_;
+            std::size_t first_ = 0; // the unconsumed bytes are [first_, last_)
+            std::size_t last_ = 0;
+
+        public:
+            static constexpr std::size_t default_block_size = 1u << 16;
+
+            istream_buffer() = default;
+            istream_buffer(std::istream & sin, std::size_t block_size)
+              : sin_(&sin)
+              , buf_((block_size == 0 ? 1 : block_size) + 1, '\0')
+            {
+                // Flush tied streams and check the stream state, as a formatted
+                // input function would.
+                std::istream::sentry const ok{sin, true};
+                more_ = ok && sin.rdbuf();
+            }
+            char const * begin() const noexcept
+            {
+                return buf_.data() + first_;
+            }
+            char const * end() const noexcept
+            {
+                return buf_.data() + last_;
+            }
+            void consume(char const * pos) noexcept
+            {
+                first_ = static_cast<std::size_t>(pos - buf_.data());
+            }
+            // Whether the whole input has been buffered.
+            bool exhausted() const noexcept
+            {
+                return !more_;
+            }
+            // Reads another block after the unconsumed bytes, growing the
+            // buffer if they fill it. Returns false once the input is
+            // exhausted.
+            bool fill()
+            {
+                if(!more_)
+                    return false;
+                if(first_ != 0)
+                {
+                    std::memmove(buf_.data(), buf_.data() + first_, last_ - first_);
+                    last_ -= first_;
+                    first_ = 0;
+                    buf_[last_] = '\0';
+                }
+                if(last_ + 1 == buf_.size())
+                    buf_.resize(buf_.size() * 2 - 1);
+                auto const n = sin_->rdbuf()->sgetn(
+                    buf_.data() + last_,
+                    static_cast<std::streamsize>(buf_.size() - 1 - last_));
+                if(n <= 0)
+                {
+                    sin_->setstate(std::ios_base::eofbit);
+                    more_ = false;
+                    return false;
+                }
+                last_ += static_cast<std::size_t>(n);
+                buf_[last_] = '\0';
+                return true;
+            }
+            void fail() noexcept
+            {
+                sin_->setstate(std::ios_base::failbit);
+                more_ = false;
+            }
+        };
+
+        inline bool is_space_(char c) noexcept
+        {
+            return c == ' ' || (c >= '\t' && c <= '\r');
+        }
+
+        // Parses the longest prefix of [first, last) that is an integer, with
+        // the grammar of std::from_chars plus an optional leading '+'. Returns
+        // a pointer past it, or first if there is none or the value does not
+        // fit in T.
+        template<typename T>
+        char const * parse_number(char const * first, char const * last, T & out,
+                                  std::true_type)
+        {
+            using U = meta::_t<std::make_unsigned<T>>;
+            char const * p = first;
+            bool neg = false;
+            if(p != last && (*p == '-' || *p == '+'))
+            {
+                neg = *p == '-';
+                if(neg && !std::is_signed<T>::value)
+                    return first;
+                ++p;
+            }
+            U const limit =
+                static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + neg);
+            U value = 0;
+            char const * const digits = p;
+            for(; p != last && static_cast<unsigned>(*p - '0') < 10u; ++p)
+            {
+                U const d = static_cast<U>(*p - '0');
+                if(value > (limit - d) / 10u)
+                    return first;
+                value = static_cast<U>(value * 10u + d);
+            }
+            if(p == digits)
+                return first;
+            out = neg && value != 0 ? static_cast<T>(-static_cast<T>(value - 1u) - 1)
+                                    : static_cast<T>(value);
+            return p;
+        }
+
+        inline bool is_digit_(char c) noexcept
+        {
+            return static_cast<unsigned>(c - '0') < 10u;
+        }
+
+        // Whether [first, last) starts with word, ignoring case
+        inline bool starts_with_nocase_(char const * first, char const * last,
+                                        char const * word) noexcept
+        {
+            for(; *word; ++first, ++word)
+                if(first == last || (*first | 0x20) != *word)
+                    return false;
+            return true;
+        }
+
+        // The end of the longest prefix of [first, last) that is a number in
+        // the general format of std::from_chars, or first if there is none:
+        // an optional '-', then a decimal mantissa with an optional exponent,
+        // or inf, infinity, nan or nan(chars) in any case.
+        inline char const * scan_float_(char const * first, char const * last) noexcept
+        {
+            char const * p = first;
+            if(p != last && *p == '-')
+                ++p;
+            if(starts_with_nocase_(p, last, "infinity"))
+                return p + 8;
+            if(starts_with_nocase_(p, last, "inf"))
+                return p + 3;
+            if(starts_with_nocase_(p, last, "nan"))
+            {
+                p += 3;
+                char const * q = p;
+                if(q != last && *q == '(')
+                {
+                    for(++q; q != last && (is_digit_(*q) || *q == '_' ||
+                                           ((*q | 0x20) >= 'a' && (*q | 0x20) <= 'z'));
+                        ++q)
+                        ;
+                    if(q != last && *q == ')')
+                        return q + 1;
+                }
+                return p;
+            }
+            bool digits = false;
+            for(; p != last && is_digit_(*p); ++p)
+                digits = true;
+            if(p != last && *p == '.')
+                for(++p; p != last && is_digit_(*p); ++p)
+                    digits = true;
+            if(!digits)
+                return first;
+            if(p != last && (*p == 'e' || *p == 'E'))
+            {
+                char const * q = p + 1;
+                if(q != last && (*q == '+' || *q == '-'))
+                    ++q;
+                if(q != last && is_digit_(*q))
+                {
+                    for(; q != last && is_digit_(*q); ++q)
+                        ;
+                    p = q;
+                }
+            }
+            return p;
+        }
+
+        inline void strto_(char const * p, char ** end, float & out)
+        {
+            out = std::strtof(p, end);
+        }
+        inline void strto_(char const * p, char ** end, double & out)
+        {
+            out = std::strtod(p, end);
+        }
+        inline void strto_(char const * p, char ** end, long double & out)
+        {
+            out = std::strtold(p, end);
+        }
+
+        // Parses a floating-point number as parse_number does, with strtod.
+        // strtod also reads hexadecimal numbers, and a decimal point that
+        // depends on the locale, so the number is first scanned for as by
+        // std::from_chars and then handed to strtod with the point of the
+        // current C locale.
+        template<typename T>
+        char const * parse_float_strto_(char const * first, char const * last, T & out)
+        {
+            char const * p = first;
+            if(p != last && *p == '+' && ++p != last && *p == '-')
+                return first;
+            char const * const end = detail::scan_float_(p, last);
+            if(end == p)
+                return first;
+            std::string text(p, end);
+            auto const point = text.find('.');
+            if(point != std::string::npos)
+                text.replace(point, 1, std::localeconv()->decimal_point);
+            char * stop = nullptr;
+            T value;
+            errno = 0;
+            detail::strto_(text.c_str(), &stop, value);
+            if(stop != text.c_str() + text.size() || errno == ERANGE)
+                return first;
+            out = value;
+            return end;
+        }
+
+        // Parses the longest prefix of [first, last) that is a floating-point
+        // number, with the grammar of std::from_chars plus an optional leading
+        // '+'. Returns a pointer past it, or first if there is none or the
+        // value is out of the range of T.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        template<typename T>
+        char const * parse_number(char const * first, char const * last, T & out,
+                                  std::false_type)
+        {
+            char const * p = first;
+            if(p != last && *p == '+' && ++p != last && *p == '-')
+                return first;
+            auto const res = std::from_chars(p, last, out);
+            return res.ec == std::errc{} ? res.ptr : first;
+        }
+#else
+        template<typename T>
+        char const * parse_number(char const * first, char const * last, T & out,
+                                  std::false_type)
+        {
+            return detail::parse_float_strto_(first, last, out);
+        }
+#endif
+
+        template<typename T>
+        RANGES_INLINE_VAR constexpr bool buffered_parseable_ =
+            (std::is_integral<T>::value && !RANGES_IS_SAME(T, bool) &&
+             !RANGES_IS_SAME(T, char) && !RANGES_IS_SAME(T, signed char) &&
+             !RANGES_IS_SAME(T, unsigned char) && !RANGES_IS_SAME(T, wchar_t) &&
+             !RANGES_IS_SAME(T, char16_t) && !RANGES_IS_SAME(T, char32_t)) ||
+            std::is_floating_point<T>::value;
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// The arithmetic values in an input stream, separated by whitespace,
+    /// like \c istream_view<Val> but without the per-element cost of \c
+    /// operator>>. The stream is read in large blocks directly from its \c
+    /// streambuf and the numbers are parsed in place, with the grammar of \c
+    /// std::from_chars (plus an optional leading \c '+'), ignoring the
+    /// stream's locale.
+    ///
+    /// As with \c istream_view, the range ends at the end of the input or at
+    /// the first malformed or out-of-range value, which sets \c failbit on
+    /// the stream. Since the view reads ahead, the stream position
+    /// afterwards is unspecified.
+    template<typename Val>
+    struct buffered_istream_view : view_facade<buffered_istream_view<Val>, unknown>
+    {
+    private:
+        friend range_access;
+        CPP_assert(detail::buffered_parseable_<Val>);
+
+        detail::istream_buffer buf_;
+        Val obj_{};
+        bool done_ = true;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            buffered_istream_view * rng_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(buffered_istream_view * rng)
+              : rng_(rng)
+            {}
+            void next()
+            {
+                rng_->next();
+            }
+            Val & read() const noexcept
+            {
+                return rng_->cached();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return rng_->done_;
+            }
+            bool equal(cursor that) const
+            {
+                return rng_->done_ == that.rng_->done_;
+            }
+        };
+        void next()
+        {
+            char const * p = buf_.begin();
+            // Skip whitespace.
+            while(true)
+            {
+                while(p != buf_.end() && detail::is_space_(*p))
+                    ++p;
+                if(p != buf_.end())
+                    break;
+                buf_.consume(p);
+                if(!buf_.fill())
+                {
+                    done_ = true;
+                    return;
+                }
+                p = buf_.begin();
+            }
+            // Make sure the whole token is buffered.
+            char const * q = p;
+            while(true)
+            {
+                while(q != buf_.end() && !detail::is_space_(*q))
+                    ++q;
+                if(q != buf_.end() || buf_.exhausted())
+                    break;
+                auto const scanned = q - p;
+                buf_.consume(p);
+                bool const more = buf_.fill();
+                p = buf_.begin();
+                q = p + scanned;
+                if(!more)
+                    break;
+            }
+            char const * const end = detail::parse_number(
+                p, buf_.end(), obj_, meta::bool_<std::is_integral<Val>::value>{});
+            if(end == p)
+            {
+                buf_.fail();
+                done_ = true;
+                return;
+            }
+            buf_.consume(end);
+        }
+        cursor begin_cursor()
+        {
+            return cursor{this};
+        }
+
+    public:
+        buffered_istream_view() = default;
+        explicit buffered_istream_view(
+            std::istream & sin,
+            std::size_t block_size = detail::istream_buffer::default_block_size)
+          : buf_(sin, block_size)
+          , done_(false)
+        {
+            next(); // prime the pump
+        }
+        Val & cached() noexcept
+        {
+            return obj_;
+        }
+    };
+
+    /// The lines of an input stream, like \c getlines_view, found with \c
+    /// std::memchr in blocks read directly from the stream's \c streambuf.
+    /// Each line is a subrange of the view's buffer, valid until the
+    /// iterator is incremented. Since the view reads ahead, the stream
+    /// position afterwards is unspecified.
+    struct buffered_getlines_view : view_facade<buffered_getlines_view, unknown>
+    {
+    private:
+        friend range_access;
+        detail::istream_buffer buf_;
+        std::size_t size_ = 0; // the current line is at the front of buf_
+        bool delimited_ = false;
+        char delim_ = '\n';
+        bool done_ = true;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            buffered_getlines_view * rng_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(buffered_getlines_view * rng)
+              : rng_(rng)
+            {}
+            void next()
+            {
+                rng_->next();
+            }
+            subrange<char const *> read() const noexcept
+            {
+                return {rng_->buf_.begin(), rng_->buf_.begin() + rng_->size_};
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return rng_->done_;
+            }
+            bool equal(cursor that) const
+            {
+                return rng_->done_ == that.rng_->done_;
+            }
+        };
+        void next()
+        {
+            buf_.consume(buf_.begin() + size_ + delimited_);
+            std::size_t scanned = 0;
+            while(true)
+            {
+                char const * const p = buf_.begin();
+                auto const size = static_cast<std::size_t>(buf_.end() - p);
+                if(auto const nl =
+                       static_cast<char const *>(std::memchr(p + scanned, delim_, size - scanned)))
+                {
+                    size_ = static_cast<std::size_t>(nl - p);
+                    delimited_ = true;
+                    return;
+                }
+                scanned = size;
+                if(!buf_.fill())
+                {
+                    // The last line need not end with a delimiter.
+                    size_ = static_cast<std::size_t>(buf_.end() - buf_.begin());
+                    delimited_ = false;
+                    done_ = size_ == 0;
+                    return;
+                }
+            }
+        }
+        cursor begin_cursor()
+        {
+            return cursor{this};
+        }
+
+    public:
+        buffered_getlines_view() = default;
+        explicit buffered_getlines_view(
+            std::istream & sin, char delim = '\n',
+            std::size_t block_size = detail::istream_buffer::default_block_size)
+          : buf_(sin, block_size)
+          , delim_(delim)
+          , done_(false)
+        {
+            next(); // prime the pump
+        }
+    };
+
+    /// The contents of an input stream as a range of contiguous chunks of up
+    /// to \c block_size characters, each read with a single call to \c sgetn
+    /// on the stream's \c streambuf. Each chunk is a subrange of the view's
+    /// buffer, valid until the iterator is incremented.
+    struct istream_chunks_view : view_facade<istream_chunks_view, unknown>
+    {
+    private:
+        friend range_access;
+        detail::istream_buffer buf_;
+        bool done_ = true;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            istream_chunks_view * rng_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(istream_chunks_view * rng)
+              : rng_(rng)
+            {}
+            void next()
+            {
+                rng_->next();
+            }
+            subrange<char const *> read() const noexcept
+            {
+                return {rng_->buf_.begin(), rng_->buf_.end()};
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return rng_->done_;
+            }
+            bool equal(cursor that) const
+            {
+                return rng_->done_ == that.rng_->done_;
+            }
+        };
+        void next()
+        {
+            buf_.consume(buf_.end());
+            done_ = !buf_.fill();
+        }
+        cursor begin_cursor()
+        {
+            return cursor{this};
+        }
+
+    public:
+        istream_chunks_view() = default;
+        explicit istream_chunks_view(
+            std::istream & sin,
+            std::size_t block_size = detail::istream_buffer::default_block_size)
+          : buf_(sin, block_size)
+          , done_(false)
+        {
+            next(); // prime the pump
+        }
+    };
+
+    /// \cond
+    namespace _buffered_istream_
+    {
+        /// \endcond
+        template(typename Val)(
+            /// \pre
+            requires detail::buffered_parseable_<Val>)
+        inline buffered_istream_view<Val> buffered_istream(
+            std::istream & sin,
+            std::size_t block_size = detail::istream_buffer::default_block_size)
+        {
+            return buffered_istream_view<Val>{sin, block_size};
+        }
+        /// \cond
+    } // namespace _buffered_istream_
+    using namespace _buffered_istream_;
+    /// \endcond
+
+    struct buffered_getlines_fn
+    {
+        buffered_getlines_view operator()(
+            std::istream & sin, char delim = '\n',
+            std::size_t block_size = detail::istream_buffer::default_block_size) const
+        {
+            return buffered_getlines_view{sin, delim, block_size};
+        }
+    };
+
+    RANGES_INLINE_VARIABLE(buffered_getlines_fn, buffered_getlines)
+
+    struct istream_chunks_fn
+    {
+        istream_chunks_view operator()(
+            std::istream & sin,
+            std::size_t block_size = detail::istream_buffer::default_block_size) const
+        {
+            return istream_chunks_view{sin, block_size};
+        }
+    };
+
+    RANGES_INLINE_VARIABLE(istream_chunks_fn, istream_chunks)
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
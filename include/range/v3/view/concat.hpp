@@ -28,6 +28,7 @@
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tuple_algorithm.hpp>
@@ -36,6 +37,8 @@
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -273,6 +276,12 @@ namespace ranges
               : rng_(rng)
               , its_{emplaced_index<cranges - 1>, end(std::get<cranges - 1>(rng->rngs_))}
             {}
+            template<std::size_t N>
+            cursor(concat_view_t * rng, meta::size_t<N>,
+                   iterator_t<constify_if<meta::at_c<meta::list<Rngs...>, N>>> it)
+              : rng_(rng)
+              , its_{emplaced_index<N>, std::move(it)}
+            {}
             template(bool Other)(
                 /// \pre
                 requires IsConst && CPP_NOT(Other)) //
@@ -366,6 +375,37 @@ namespace ranges
             return {this, end_tag{}};
         }
 
+        using simple_ = meta::and_c<simple_view<Rngs>()...>;
+        using simple_cursor_t = cursor<simple_::value>;
+
+        template<typename F, std::size_t N>
+        basic_iterator<simple_cursor_t> visit_segments_(F & f, meta::size_t<N>)
+        {
+            using Rng = meta::const_if<simple_, meta::at_c<meta::list<Rngs...>, N>>;
+            auto & rng = static_cast<Rng &>(std::get<N>(rngs_));
+            auto it = detail::for_each_segment(rng, f);
+            if(it != ranges::end(rng))
+                return basic_iterator<simple_cursor_t>{
+                    simple_cursor_t{this, meta::size_t<N>{}, std::move(it)}};
+            return this->visit_segments_(f, meta::size_t<N + 1>{});
+        }
+        template<typename F>
+        basic_iterator<simple_cursor_t> visit_segments_(F & f, meta::size_t<cranges - 1>)
+        {
+            using Rng = meta::const_if<simple_, meta::back<meta::list<Rngs...>>>;
+            auto & rng = static_cast<Rng &>(std::get<cranges - 1>(rngs_));
+            return basic_iterator<simple_cursor_t>{simple_cursor_t{
+                this, meta::size_t<cranges - 1>{}, detail::for_each_segment(rng, f)}};
+        }
+
+        // Visit the ranges one after the other; algorithms reach this through
+        // range_access, see detail/segmented.hpp.
+        template<typename F>
+        basic_iterator<simple_cursor_t> for_each_segment(F & f)
+        {
+            return this->visit_segments_(f, meta::size_t<0>{});
+        }
+
     public:
         concat_view() = default;
         explicit concat_view(Rngs... rngs)
@@ -404,6 +444,13 @@ namespace ranges
                 size_type{0},
                 plus{});
         }
+        size_hint_t size_hint() const
+        {
+            return tuple_foldl(
+                tuple_transform(rngs_, [](auto && r) { return ranges::size_hint(r); }),
+                size_hint_t{0, 0},
+                plus{});
+        }
     };
 
 #if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_JOIN_HPP
 #define RANGES_V3_VIEW_JOIN_HPP
 
+#include <array>
 #include <type_traits>
 #include <utility>
 
@@ -25,6 +26,7 @@
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/range_for.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -34,6 +36,8 @@
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/segmented.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -124,7 +128,52 @@ namespace ranges
         CPP_concept has_arrow_ =
             input_iterator<I> &&
             (std::is_pointer<I>::value || CPP_requires_ref(detail::has_member_arrow_, I));
+
+        template(typename Rng)(
+        concept (join_size_hintable_)(Rng),
+            std::is_reference<range_reference_t<Rng>>::value AND
+            has_size_hint_v<range_reference_t<Rng>>);
+
+        // Whether the size hints of the inner ranges can be added up without
+        // evaluating the outer range more than once.
+        template<typename Rng>
+        CPP_concept join_size_hintable =
+            forward_range<Rng> && CPP_concept_ref(detail::join_size_hintable_, Rng);
+
+        template(typename Rng)(
+        concept (join_random_access_)(Rng),
+            std::is_reference<range_reference_t<Rng>>::value AND
+            random_access_range<range_reference_t<Rng>> AND
+            common_range<range_reference_t<Rng>> AND
+            (range_cardinality<range_reference_t<Rng>>::value > 0));
+
+        // Whether joining the inner ranges of Rng gives a random-access range:
+        // they all have the same number of elements, known at compile time,
+        // as arrays do. Inner ranges whose sizes are only known at run time
+        // stay bidirectional, since nothing in their types promises that the
+        // sizes agree; views::join of views::chunk is handled separately.
+        template<typename Rng>
+        CPP_concept join_random_access =
+            random_access_range<Rng> && CPP_concept_ref(detail::join_random_access_, Rng);
         // clang-format on
+
+        template<typename T>
+        RANGES_INLINE_VAR constexpr bool join_is_array_ = false;
+        template<typename T, std::size_t N>
+        RANGES_INLINE_VAR constexpr bool join_is_array_<T[N]> = true;
+        template<typename T, std::size_t N>
+        RANGES_INLINE_VAR constexpr bool join_is_array_<std::array<T, N>> =
+            sizeof(std::array<T, N>) == sizeof(T[N]);
+
+        // Whether the elements of the inner ranges of Rng are laid out one
+        // after the other in memory: Rng is a contiguous range of arrays.
+        // Treating them as one array means pointer arithmetic that crosses
+        // from one array into the next, which the standard does not strictly
+        // allow, though every implementation supports it; it is deliberate,
+        // as it is for the multidimensional arrays of the language.
+        template<typename Rng>
+        RANGES_INLINE_VAR constexpr bool join_contiguous_ =
+            contiguous_range<Rng> && join_is_array_<range_value_t<Rng>>;
     } // namespace detail
     /// \endcond
 
@@ -169,6 +218,24 @@ namespace ranges
                 n += ranges::size(inner);
             return n;
         }
+        // Not to spec
+        CPP_auto_member
+        constexpr auto CPP_fun(size)()(const //
+            /// \pre
+            requires (detail::join_cardinality<Rng>() < 0) &&
+                (range_cardinality<range_reference_t<Rng>>::value >= 0) &&
+                sized_range<Rng const>)
+        {
+            return ranges::size(outer_) *
+                   static_cast<range_size_t<Rng const>>(
+                       range_cardinality<range_reference_t<Rng>>::value);
+        }
+        /// The sum of the size hints of the inner ranges, if they can be
+        /// visited without evaluating the outer range twice
+        size_hint_t size_hint() const
+        {
+            return size_hint_(meta::bool_<detail::join_size_hintable<Rng const>>{});
+        }
         // // ericniebler/stl2#605
         constexpr Rng base() const
         {
@@ -179,6 +246,18 @@ namespace ranges
         friend range_access;
         Rng outer_{};
 
+        size_hint_t size_hint_(std::true_type) const
+        {
+            size_hint_t hint{0, 0};
+            RANGES_FOR(auto && inner, outer_)
+                hint = hint + ranges::size_hint(inner);
+            return hint;
+        }
+        size_hint_t size_hint_(std::false_type) const
+        {
+            return {};
+        }
+
         template<bool Const>
         struct cursor
         {
@@ -192,6 +271,22 @@ namespace ranges
             iterator_t<COuter> outer_it_{};
             iterator_t<CInner> inner_it_{};
 
+            // When the inner ranges all have N elements, the cursor is at
+            // (outer_it_ - begin(outer)) * N + (inner_it_ - begin(*outer_it_)).
+            static constexpr range_difference_t<COuter> extent_() noexcept
+            {
+                return static_cast<range_difference_t<COuter>>(
+                    range_cardinality<CInner>::value);
+            }
+            constexpr range_difference_t<COuter> position_() const
+            {
+                auto const pos = (outer_it_ - ranges::begin(rng_->outer_)) * extent_();
+                if(outer_it_ == ranges::end(rng_->outer_))
+                    return pos;
+                return pos + static_cast<range_difference_t<COuter>>(
+                                 inner_it_ - ranges::begin(*outer_it_));
+            }
+
             void satisfy()
             {
                 for(; outer_it_ != ranges::end(rng_->outer_); ++outer_it_)
@@ -209,6 +304,8 @@ namespace ranges
             using single_pass = meta::bool_<single_pass_iterator_<iterator_t<COuter>> ||
                                             single_pass_iterator_<iterator_t<CInner>> ||
                                             !ref_is_glvalue::value>;
+            using contiguous = meta::bool_<detail::join_random_access<COuter> &&
+                                           detail::join_contiguous_<COuter>>;
             cursor() = default;
             template<typename BeginOrEnd>
             constexpr cursor(Parent * rng, BeginOrEnd begin_or_end)
@@ -217,6 +314,12 @@ namespace ranges
             {
                 satisfy();
             }
+            constexpr cursor(Parent * rng, iterator_t<COuter> outer_it,
+                             iterator_t<CInner> inner_it)
+              : rng_{rng}
+              , outer_it_(std::move(outer_it))
+              , inner_it_(std::move(inner_it))
+            {}
             template(bool Other)(
                 /// \pre
                 requires Const AND CPP_NOT(Other) AND
@@ -274,6 +377,27 @@ namespace ranges
                     inner_it_ = ranges::end(*--outer_it_);
                 --inner_it_;
             }
+            CPP_member
+            constexpr auto advance(range_difference_t<COuter> n) //
+                -> CPP_ret(void)(
+                    /// \pre
+                    requires detail::join_random_access<COuter>)
+            {
+                auto const pos = position_() + n;
+                outer_it_ = ranges::begin(rng_->outer_) + pos / extent_();
+                if(outer_it_ == ranges::end(rng_->outer_))
+                    inner_it_ = iterator_t<CInner>();
+                else
+                    inner_it_ = ranges::begin(*outer_it_) + pos % extent_();
+            }
+            CPP_member
+            constexpr auto distance_to(cursor const & that) const //
+                -> CPP_ret(range_difference_t<COuter>)(
+                    /// \pre
+                    requires detail::join_random_access<COuter>)
+            {
+                return that.position_() - position_();
+            }
             // clang-format off
             constexpr auto CPP_auto_fun(read)()(const)
             (
@@ -317,6 +441,26 @@ namespace ranges
             return {this, ranges::begin};
         }
 
+        // Visit the inner ranges one after the other; algorithms reach this
+        // through range_access, see detail/segmented.hpp.
+        template<typename F>
+        basic_iterator<cursor<use_const_always()>> for_each_segment(F & f)
+        {
+            using cursor_t = cursor<use_const_always()>;
+            auto & outer = static_cast<meta::const_if_c<use_const_always(), Rng> &>(outer_);
+            auto outer_it = ranges::begin(outer);
+            for(auto const outer_last = ranges::end(outer); outer_it != outer_last;
+                ++outer_it)
+            {
+                auto & inner = this->update_inner_(*outer_it);
+                auto inner_it = detail::for_each_segment(inner, f);
+                if(inner_it != ranges::end(inner))
+                    return basic_iterator<cursor_t>{
+                        cursor_t{this, std::move(outer_it), std::move(inner_it)}};
+            }
+            return basic_iterator<cursor_t>{cursor_t{this, std::move(outer_it), {}}};
+        }
+
         template(bool Const = true)(
             /// \pre
             requires Const AND input_range<meta::const_if_c<Const, Rng>> AND
@@ -555,8 +699,30 @@ namespace ranges
         private:
             template<typename Rng>
             using inner_value_t = range_value_t<range_reference_t<Rng>>;
+            template<typename Rng>
+            static join_view<Rng> join_(Rng rng)
+            {
+                return join_view<Rng>{std::move(rng)};
+            }
+            // The chunks of a forward range are consecutive pieces of it, so
+            // joining them gives back the range, with all of its properties.
+            template(typename Rng)(
+                /// \pre
+                requires forward_range<Rng>)
+            static Rng join_(chunk_view<Rng> rng)
+            {
+                return rng.base();
+            }
+
         public:
-            using cpp20_join_fn::operator();
+            template(typename Rng)(
+                /// \pre
+                requires joinable_range<Rng>)
+            auto operator()(Rng && rng) const
+                -> decltype(join_base_fn::join_(all(static_cast<Rng &&>(rng))))
+            {
+                return join_base_fn::join_(all(static_cast<Rng &&>(rng)));
+            }
 
             template(typename Rng)(
                 /// \pre
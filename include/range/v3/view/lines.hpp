@@ -0,0 +1,176 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_LINES_HPP
+#define RANGES_V3_VIEW_LINES_HPP
+
+#include <cstring>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/subrange.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// The lines of a contiguous range of \c char, as subranges of it. Each
+    /// line ends before a delimiter; like \c std::getline, a delimiter at the
+    /// very end of the range does not start another, empty, line. Lines are
+    /// found with \c std::memchr and never copied.
+    template<typename Rng>
+    struct lines_view
+      : view_facade<lines_view<Rng>, is_finite<Rng>::value ? finite : unknown>
+    {
+    private:
+        friend range_access;
+        CPP_assert(view_<Rng> && contiguous_range<Rng const> && sized_range<Rng const>);
+        CPP_assert(same_as<range_value_t<Rng>, char>);
+
+        Rng rng_;
+        char delim_ = '\n';
+
+        struct cursor
+        {
+        private:
+            char const * first_ = nullptr; // the current line
+            char const * last_ = nullptr;
+            char const * end_ = nullptr; // the end of the range
+            char delim_ = '\n';
+
+            void find_end() noexcept
+            {
+                auto const nl = static_cast<char const *>(
+                    std::memchr(first_, delim_, static_cast<std::size_t>(end_ - first_)));
+                last_ = nl ? nl : end_;
+            }
+
+        public:
+            cursor() = default;
+            cursor(char const * first, char const * end, char delim) noexcept
+              : first_(first)
+              , end_(end)
+              , delim_(delim)
+            {
+                if(first_ != end_)
+                    find_end();
+            }
+            subrange<char const *> read() const noexcept
+            {
+                return {first_, last_};
+            }
+            void next() noexcept
+            {
+                first_ = last_ == end_ ? end_ : last_ + 1;
+                if(first_ != end_)
+                    find_end();
+            }
+            bool equal(cursor const & that) const noexcept
+            {
+                return first_ == that.first_;
+            }
+        };
+        cursor begin_cursor() const
+        {
+            char const * const first = ranges::data(rng_);
+            return {first, first + ranges::size(rng_), delim_};
+        }
+        cursor end_cursor() const
+        {
+            char const * const last = ranges::data(rng_) + ranges::size(rng_);
+            return {last, last, delim_};
+        }
+
+    public:
+        lines_view() = default;
+        explicit lines_view(Rng rng, char delim = '\n')
+          : rng_(std::move(rng))
+          , delim_(delim)
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+#if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
+    template<typename Rng>
+    lines_view(Rng &&, char)->lines_view<views::all_t<Rng>>;
+    template<typename Rng>
+    lines_view(Rng &&)->lines_view<views::all_t<Rng>>;
+#endif
+
+    namespace views
+    {
+        // clang-format off
+        /// \concept lineable_range_of_char_
+        /// The \c lineable_range_of_char_ concept
+        template(typename Rng)(
+        concept (lineable_range_of_char_)(Rng),
+            same_as<range_value_t<Rng>, char>
+        );
+        /// \concept lineable_range_
+        /// The \c lineable_range_ concept
+        template<typename Rng>
+        CPP_concept lineable_range_ =
+            viewable_range<Rng> && contiguous_range<Rng> && sized_range<Rng> &&
+            CPP_concept_ref(views::lineable_range_of_char_, Rng);
+        // clang-format on
+
+        struct lines_base_fn
+        {
+            template(typename Rng)(
+                /// \pre
+                requires lineable_range_<Rng>)
+            lines_view<all_t<Rng>> operator()(Rng && rng, char delim = '\n') const
+            {
+                return lines_view<all_t<Rng>>{all(static_cast<Rng &&>(rng)), delim};
+            }
+        };
+
+        struct lines_fn : lines_base_fn
+        {
+            using lines_base_fn::operator();
+
+            constexpr auto operator()(char delim) const
+            {
+                return make_view_closure(bind_back(lines_base_fn{}, delim));
+            }
+        };
+
+        /// \relates lines_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(view_closure<lines_fn>, lines)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+RANGES_SATISFY_BOOST_RANGE(::ranges::lines_view)
+
+#endif
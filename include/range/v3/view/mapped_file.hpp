@@ -0,0 +1,242 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MAPPED_FILE_HPP
+#define RANGES_V3_VIEW_MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/interface.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define RANGES_MAPPED_FILE_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#define RANGES_MAPPED_FILE_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef RANGES_MAPPED_FILE_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef RANGES_MAPPED_FILE_LEAN_AND_MEAN
+#endif
+#ifdef RANGES_MAPPED_FILE_NOMINMAX
+#undef NOMINMAX
+#undef RANGES_MAPPED_FILE_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // A read-only mapping of a whole file into memory. Empty files are
+        // not mapped at all, since neither mmap nor MapViewOfFile accept a
+        // length of zero.
+        class file_mapping
+        {
+            char const * data_ = nullptr;
+            std::size_t size_ = 0;
+
+#if defined(_WIN32)
+            [[noreturn]] static void fail(char const * what)
+            {
+                throw std::system_error(
+                    static_cast<int>(::GetLastError()), std::system_category(), what);
+            }
+
+        public:
+            explicit file_mapping(std::string const & path)
+            {
+                HANDLE const file = ::CreateFileA(path.c_str(),
+                                                  GENERIC_READ,
+                                                  FILE_SHARE_READ,
+                                                  nullptr,
+                                                  OPEN_EXISTING,
+                                                  FILE_FLAG_SEQUENTIAL_SCAN,
+                                                  nullptr);
+                if(file == INVALID_HANDLE_VALUE)
+                    fail("mapped_file: cannot open file");
+                LARGE_INTEGER size;
+                if(!::GetFileSizeEx(file, &size))
+                {
+                    ::CloseHandle(file);
+                    fail("mapped_file: cannot get file size");
+                }
+                size_ = static_cast<std::size_t>(size.QuadPart);
+                if(size_ != 0)
+                {
+                    HANDLE const mapping =
+                        ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    ::CloseHandle(file);
+                    if(!mapping)
+                        fail("mapped_file: cannot map file");
+                    data_ = static_cast<char const *>(
+                        ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    ::CloseHandle(mapping);
+                    if(!data_)
+                        fail("mapped_file: cannot map file");
+                }
+                else
+                    ::CloseHandle(file);
+            }
+            ~file_mapping()
+            {
+                if(data_)
+                    ::UnmapViewOfFile(data_);
+            }
+#else
+            [[noreturn]] static void fail(char const * what)
+            {
+                throw std::system_error(errno, std::generic_category(), what);
+            }
+
+        public:
+            explicit file_mapping(std::string const & path)
+            {
+                int const fd = ::open(path.c_str(), O_RDONLY);
+                if(fd < 0)
+                    fail("mapped_file: cannot open file");
+                struct stat st;
+                if(::fstat(fd, &st) != 0)
+                {
+                    int const err = errno;
+                    ::close(fd);
+                    errno = err;
+                    fail("mapped_file: cannot get file size");
+                }
+                size_ = static_cast<std::size_t>(st.st_size);
+                if(size_ != 0)
+                {
+                    void * const p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    int const err = errno;
+                    ::close(fd);
+                    if(p == MAP_FAILED)
+                    {
+                        errno = err;
+                        fail("mapped_file: cannot map file");
+                    }
+                    data_ = static_cast<char const *>(p);
+#ifdef POSIX_MADV_SEQUENTIAL
+                    ::posix_madvise(p, size_, POSIX_MADV_SEQUENTIAL);
+#endif
+                }
+                else
+                    ::close(fd);
+            }
+            ~file_mapping()
+            {
+                if(data_)
+                    ::munmap(const_cast<char *>(data_), size_);
+            }
+#endif
+            file_mapping(file_mapping const &) = delete;
+            file_mapping & operator=(file_mapping const &) = delete;
+
+            char const * data() const noexcept
+            {
+                return data_;
+            }
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// The contents of a file, mapped read-only into memory, as a contiguous
+    /// range of \c char. No bytes are copied: reading the range reads the
+    /// page cache directly. Copies of the view share the mapping, which is
+    /// released when the last of them is destroyed, so iterators must not
+    /// outlive every copy of the view they came from.
+    ///
+    /// This header includes the platform's headers for mapping files,
+    /// \c <windows.h> or \c <sys/mman.h> and its companions, and so is not
+    /// included by \c <range/v3/view.hpp>; include it on its own.
+    struct mapped_file_view : view_interface<mapped_file_view, finite>
+    {
+    private:
+        std::shared_ptr<detail::file_mapping const> file_;
+        char const * data_ = nullptr;
+        std::size_t size_ = 0;
+
+    public:
+        mapped_file_view() = default;
+
+        /// Maps the file at \c path. \throw std::system_error if the file
+        /// cannot be opened or mapped.
+        explicit mapped_file_view(std::string const & path)
+          : file_(std::make_shared<detail::file_mapping>(path))
+          , data_(file_->data())
+          , size_(file_->size())
+        {}
+
+        char const * begin() const noexcept
+        {
+            return data_;
+        }
+        char const * end() const noexcept
+        {
+            return data_ + size_;
+        }
+        char const * data() const noexcept
+        {
+            return data_;
+        }
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+    };
+
+    namespace views
+    {
+        struct mapped_file_fn
+        {
+            mapped_file_view operator()(std::string const & path) const
+            {
+                return mapped_file_view{path};
+            }
+        };
+
+        /// \relates mapped_file_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(mapped_file_fn, mapped_file)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
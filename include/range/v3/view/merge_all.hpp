@@ -0,0 +1,187 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MERGE_ALL_HPP
+#define RANGES_V3_VIEW_MERGE_ALL_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <range/v3/detail/loser_tree.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// The elements of a range of sorted ranges, merged into one sorted
+    /// sequence by a tournament tree, so that each element costs O(log k)
+    /// comparisons for k ranges. Equal elements come in the order of the
+    /// ranges they belong to.
+    ///
+    /// The tree is built by the first call to \c begin and lives in the view,
+    /// so that iterators stay cheap to copy; the view is therefore an input
+    /// range, and its iterators all share one position.
+    template<typename Rng, typename C, typename P>
+    struct merge_all_view
+      : view_facade<merge_all_view<Rng, C, P>,
+                    is_finite<Rng>::value && is_finite<range_reference_t<Rng>>::value
+                        ? finite
+                        : unknown>
+    {
+    private:
+        friend range_access;
+        using inner_t = range_reference_t<Rng>;
+        using tree_t = detail::loser_tree<iterator_t<inner_t>, sentinel_t<inner_t>>;
+        semiregular_box_t<C> pred_;
+        semiregular_box_t<P> proj_;
+        Rng rng_;
+        detail::non_propagating_cache<tree_t> tree_;
+
+        struct cursor
+        {
+        private:
+            merge_all_view * rng_ = nullptr;
+
+        public:
+            using value_type = range_value_t<inner_t>;
+            using single_pass = std::true_type;
+
+            cursor() = default;
+            explicit cursor(merge_all_view * rng)
+              : rng_(rng)
+            {}
+            // clang-format off
+            auto CPP_auto_fun(read)()(const)
+            (
+                return *rng_->tree_->top().it
+            )
+            // clang-format on
+            void next()
+            {
+                rng_->tree_->pop(rng_->pred_, rng_->proj_);
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return rng_->tree_->active() == 0;
+            }
+            // clang-format off
+            auto CPP_auto_fun(move)()(const)
+            (
+                return iter_move(rng_->tree_->top().it)
+            )
+            // clang-format on
+        };
+
+        cursor begin_cursor()
+        {
+            if(!tree_)
+            {
+                tree_t & tree = tree_.emplace();
+                RANGES_FOR(auto && inner, rng_)
+                    tree.push_back(ranges::begin(inner), ranges::end(inner));
+                tree.build(pred_, proj_);
+            }
+            return cursor{this};
+        }
+
+    public:
+        merge_all_view() = default;
+        merge_all_view(Rng rng, C pred, P proj)
+          : pred_(std::move(pred))
+          , proj_(std::move(proj))
+          , rng_(std::move(rng))
+        {}
+        /// The sum of the size hints of the merged ranges
+        CPP_member
+        auto size_hint() const //
+            -> CPP_ret(size_hint_t)(
+                /// \pre
+                requires forward_range<Rng const>)
+        {
+            size_hint_t hint{0, 0};
+            RANGES_FOR(auto && inner, rng_)
+                hint = hint + ranges::size_hint(inner);
+            return hint;
+        }
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    namespace views
+    {
+        struct merge_all_base_fn
+        {
+            template(typename Rng, typename C = less, typename P = identity)(
+                /// \pre
+                requires viewable_range<Rng> AND forward_range<Rng> AND
+                    borrowed_range<range_reference_t<Rng>> AND
+                    input_range<range_reference_t<Rng>> AND
+                    indirect_strict_weak_order<
+                        C, projected<iterator_t<range_reference_t<Rng>>, P>>)
+            merge_all_view<all_t<Rng>, C, P> //
+            operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+            {
+                return {all(static_cast<Rng &&>(rng)), std::move(pred), std::move(proj)};
+            }
+        };
+
+        struct merge_all_fn : merge_all_base_fn
+        {
+            using merge_all_base_fn::operator();
+
+            template(typename C, typename P = identity)(
+                /// \pre
+                requires (!range<C>))
+            constexpr auto operator()(C && pred, P proj = P{}) const
+            {
+                return make_view_closure(bind_back(
+                    merge_all_base_fn{}, static_cast<C &&>(pred), std::move(proj)));
+            }
+        };
+
+        /// \relates merge_all_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(view_closure<merge_all_fn>, merge_all)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+
+#endif
@@ -0,0 +1,311 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PAR_HPP
+#define RANGES_V3_VIEW_PAR_HPP
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/compose.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <range/v3/detail/prologue.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // The elements of one chunk, evaluated ahead of time: the addresses
+        // of the objects they refer to, when ByAddress, or else copies of
+        // them.
+        template<typename Ref, bool ByAddress>
+        using par_buffer_elem_t =
+            meta::if_c<ByAddress, meta::_t<std::remove_reference<Ref>> *, uncvref_t<Ref>>;
+
+        template<typename Ref>
+        par_buffer_elem_t<Ref, true> par_buffer_put(Ref && ref, std::true_type)
+        {
+            return std::addressof(ref);
+        }
+        template<typename Ref>
+        par_buffer_elem_t<Ref, false> par_buffer_put(Ref && ref, std::false_type)
+        {
+            return static_cast<Ref &&>(ref);
+        }
+
+        template<typename Ref>
+        Ref par_buffer_get(par_buffer_elem_t<Ref, true> & elem, std::true_type)
+        {
+            return static_cast<Ref>(*elem);
+        }
+        template<typename Ref>
+        Ref par_buffer_get(par_buffer_elem_t<Ref, false> & elem, std::false_type)
+        {
+            return static_cast<Ref &&>(elem);
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// A range split into chunks of \c n elements, with a pipeline of further
+    /// views applied to each chunk. Views piped into a \c par_view are added
+    /// to its pipeline, so that in
+    /// <tt>rng | views::par(pool, n) | views::transform(f) | views::filter(p)</tt>
+    /// each chunk of \c rng is transformed and filtered separately.
+    ///
+    /// Iterating the view evaluates the chunks in order on the calling thread.
+    /// \c ranges::to, \c ranges::for_each and \c ranges::accumulate instead
+    /// evaluate the pipeline of every chunk concurrently on the thread pool,
+    /// buffering the results, and then visit the elements in their original
+    /// order. The stages of the pipeline may be invoked concurrently, and
+    /// only stages that treat each element on its own, like \c transform and
+    /// \c filter, give the same elements as applying them to the whole range.
+    /// The elements of a pipeline whose iterators are single-pass, like one
+    /// that ends in \c views::cache1, are buffered as copies, which writes
+    /// through their references by \c ranges::for_each change.
+    template<typename Rng, typename Stages>
+    struct par_view
+      : view_facade<par_view<Rng, Stages>, is_finite<Rng>::value ? finite : unknown>
+    {
+    private:
+        friend range_access;
+        CPP_assert(view_<Rng> && random_access_range<Rng> && sized_range<Rng>);
+
+        using chunks_t = chunk_view<Rng>;
+        using inner_t = invoke_result_t<Stages const &, range_reference_t<chunks_t>>;
+        CPP_assert(view_<inner_t> && input_range<inner_t>);
+        using ref_t = range_reference_t<inner_t>;
+
+        chunks_t chunks_;
+        range_difference_t<Rng> n_ = 0;
+        semiregular_box_t<Stages> stages_;
+        thread_pool * pool_ = nullptr;
+        detail::non_propagating_cache<inner_t> inner_;
+
+        inner_t & update_inner_(iterator_t<chunks_t> const & it)
+        {
+            return inner_.emplace(invoke(stages(), *it));
+        }
+
+        struct cursor
+        {
+        private:
+            par_view * rng_ = nullptr;
+            iterator_t<chunks_t> outer_it_{};
+            iterator_t<inner_t> inner_it_{};
+
+            void satisfy()
+            {
+                for(; outer_it_ != ranges::end(rng_->chunks_); ++outer_it_)
+                {
+                    auto & inner = rng_->update_inner_(outer_it_);
+                    inner_it_ = ranges::begin(inner);
+                    if(inner_it_ != ranges::end(inner))
+                        return;
+                }
+            }
+
+        public:
+            using single_pass = std::true_type;
+            cursor() = default;
+            cursor(par_view * rng, iterator_t<chunks_t> outer_it, bool begin)
+              : rng_(rng)
+              , outer_it_(std::move(outer_it))
+            {
+                if(begin)
+                    satisfy();
+            }
+            ref_t read() const
+            {
+                return *inner_it_;
+            }
+            void next()
+            {
+                if(++inner_it_ == ranges::end(*rng_->inner_))
+                {
+                    ++outer_it_;
+                    satisfy();
+                }
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return outer_it_ == ranges::end(rng_->chunks_);
+            }
+        };
+        cursor begin_cursor()
+        {
+            return {this, ranges::begin(chunks_), true};
+        }
+
+        // Evaluate the pipeline of every chunk on the pool, then invoke f on
+        // the elements in order. Algorithms reach this through range_access;
+        // see detail/chunked.hpp.
+        template<typename F>
+        basic_iterator<cursor> for_each_chunked(F & f)
+        {
+            // References into the pipeline of a chunk stay valid as long as
+            // the pipeline, which is kept until the end, unless its iterators
+            // are single-pass and may refer to a value they cache, as those
+            // of views::cache1 do. The elements of those are copied.
+            using by_address =
+                meta::bool_<std::is_reference<ref_t>::value && forward_range<inner_t>>;
+            using buffer_t =
+                std::vector<detail::par_buffer_elem_t<ref_t, by_address::value>>;
+            auto const first = ranges::begin(chunks_);
+            auto const n = ranges::distance(chunks_);
+            std::vector<buffer_t> buffers(static_cast<std::size_t>(n));
+            std::vector<detail::non_propagating_cache<inner_t>> inners(
+                by_address::value ? static_cast<std::size_t>(n) : 0u);
+            auto eval = [&, this](std::ptrdiff_t lo, std::ptrdiff_t hi) {
+                for(; lo != hi; ++lo)
+                {
+                    detail::non_propagating_cache<inner_t> tmp;
+                    auto & inner = (by_address::value ? inners[static_cast<std::size_t>(lo)]
+                                                      : tmp)
+                                       .emplace(invoke(stages(), first[lo]));
+                    auto & buffer = buffers[static_cast<std::size_t>(lo)];
+                    for(auto it = ranges::begin(inner), last = ranges::end(inner);
+                        it != last;
+                        ++it)
+                        buffer.push_back(detail::par_buffer_put<ref_t>(*it, by_address{}));
+                }
+            };
+            thread_pool & pool = pool_ ? *pool_ : thread_pool::current();
+            pool.run([&] { detail::parallel_for(n, 1, eval); });
+            for(auto & buffer : buffers)
+            {
+                for(auto & elem : buffer)
+                    f(detail::par_buffer_get<ref_t>(elem, by_address{}));
+                buffer_t{}.swap(buffer);
+            }
+            return basic_iterator<cursor>{cursor{this, first + n, false}};
+        }
+
+        Stages const & stages() const noexcept
+        {
+            return stages_;
+        }
+
+    public:
+        par_view() = default;
+        par_view(Rng rng, range_difference_t<Rng> n, Stages stages,
+                 thread_pool * pool = nullptr)
+          : chunks_(std::move(rng), n)
+          , n_(n)
+          , stages_(std::move(stages))
+          , pool_(pool)
+        {}
+        Rng base() const
+        {
+            return chunks_.base();
+        }
+
+        /// Adds a view to the pipeline that is applied to each chunk.
+        template<typename ViewFn>
+        friend auto operator|(par_view rng, views::view_closure<ViewFn> vw)
+            -> CPP_broken_friend_ret(par_view<Rng, composed<ViewFn, Stages>>)(
+                /// \pre
+                requires invocable<ViewFn const &, inner_t>)
+        {
+            return {rng.base(),
+                    rng.n_,
+                    compose(static_cast<ViewFn &&>(vw), rng.stages()),
+                    rng.pool_};
+        }
+    };
+
+    namespace views
+    {
+        struct par_base_fn
+        {
+            template(typename Rng)(
+                /// \pre
+                requires viewable_range<Rng> AND random_access_range<Rng> AND
+                    sized_range<Rng>)
+            par_view<all_t<Rng>, all_fn> //
+            operator()(Rng && rng, thread_pool & pool, range_difference_t<Rng> n) const
+            {
+                return {all(static_cast<Rng &&>(rng)), n, all_fn{}, &pool};
+            }
+            template(typename Rng)(
+                /// \pre
+                requires viewable_range<Rng> AND random_access_range<Rng> AND
+                    sized_range<Rng>)
+            par_view<all_t<Rng>, all_fn> //
+            operator()(Rng && rng, range_difference_t<Rng> n) const
+            {
+                return {all(static_cast<Rng &&>(rng)), n, all_fn{}};
+            }
+        };
+
+        struct par_fn : par_base_fn
+        {
+            using par_base_fn::operator();
+
+            template(typename Int)(
+                /// \pre
+                requires detail::integer_like_<Int>)
+            auto operator()(thread_pool & pool, Int n) const
+            {
+                return make_view_closure(bind_back(par_base_fn{}, std::ref(pool), n));
+            }
+            template(typename Int)(
+                /// \pre
+                requires detail::integer_like_<Int>)
+            constexpr auto operator()(Int n) const
+            {
+                return make_view_closure(bind_back(par_base_fn{}, n));
+            }
+        };
+
+        /// Splits a random-access range into chunks of \c n elements whose
+        /// pipelines \c ranges::to, \c ranges::for_each and
+        /// \c ranges::accumulate evaluate concurrently on \c pool, or on
+        /// \c thread_pool::current() if no pool is given.
+        /// \relates par_fn
+        /// \ingroup group-views
+        RANGES_INLINE_VARIABLE(par_fn, par)
+    } // namespace views
+    /// @}
+} // namespace ranges
+
+#include <range/v3/detail/epilogue.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+RANGES_SATISFY_BOOST_RANGE(::ranges::par_view)
+
+#endif
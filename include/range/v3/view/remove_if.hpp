@@ -26,6 +26,7 @@
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/box.hpp>
 #include <range/v3/utility/optional.hpp>
@@ -51,6 +52,11 @@ namespace ranges
           : remove_if_view::view_adaptor{detail::move(rng)}
           , remove_if_view::box(detail::move(pred))
         {}
+        /// Anywhere from none to all of the elements of the underlying range
+        constexpr size_hint_t size_hint() const
+        {
+            return {0, ranges::size_hint(this->base()).upper};
+        }
 
     private:
         friend range_access;
@@ -14,15 +14,22 @@
 #ifndef RANGES_V3_VIEW_SAMPLE_HPP
 #define RANGES_V3_VIEW_SAMPLE_HPP
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include <meta/meta.hpp>
 
+#include <range/v3/algorithm/sample.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/facade.hpp>
@@ -107,17 +114,16 @@ namespace ranges
             {
                 if(parent_->size_ > 0)
                 {
-                    using Dist = std::uniform_int_distribution<D>;
-                    Dist dist{};
                     URNG & engine = *parent_->engine_;
+                    auto const size = static_cast<std::uint64_t>(parent_->size_);
 
                     for(;; ++current_, size_.decrement())
                     {
                         RANGES_ASSERT(current_ != ranges::end(parent_->rng_));
                         auto n = pop_size();
                         RANGES_EXPECT(n > 0);
-                        typename Dist::param_type const interval{0, n - 1};
-                        if(dist(engine, interval) < parent_->size_)
+                        if(detail::bounded_random(engine, static_cast<std::uint64_t>(n)) <
+                           size)
                             break;
                     }
                 }
@@ -206,6 +212,111 @@ namespace ranges
         ->sample_view<views::all_t<Rng>, URNG>;
 #endif
 
+    /// A random sample of an input range whose size is not known ahead of
+    /// time, in the order of the range. The range is read through once, by
+    /// \c begin, into a reservoir of the sample's size, skipping ahead over
+    /// the elements that will not be kept as \c ranges::sample does.
+    template<typename Rng, typename URNG>
+    class reservoir_sample_view
+      : public view_facade<reservoir_sample_view<Rng, URNG>, finite>
+    {
+        friend range_access;
+        using D = range_difference_t<Rng>;
+        using V = range_value_t<Rng>;
+        Rng rng_;
+        D size_ = 0;
+        URNG * engine_ = nullptr;
+        // Not copied with the view, so that copies of it stay cheap
+        detail::non_propagating_cache<std::vector<V>> sample_;
+
+        struct cursor
+        {
+        private:
+            reservoir_sample_view * parent_ = nullptr;
+            std::size_t pos_ = 0;
+
+        public:
+            using single_pass = std::true_type;
+
+            cursor() = default;
+            explicit cursor(reservoir_sample_view * parent)
+              : parent_(parent)
+            {}
+            V & read() const
+            {
+                return (*parent_->sample_)[pos_];
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return pos_ == parent_->sample_->size();
+            }
+            void next()
+            {
+                ++pos_;
+            }
+        };
+
+        void fill_()
+        {
+            URNG & engine = *engine_;
+            // Each element of the reservoir with its position in the range
+            std::vector<std::pair<D, V>> reservoir;
+            auto it = ranges::begin(rng_);
+            auto const last = ranges::end(rng_);
+            D pos = 0;
+            for(; pos < size_ && it != last; ++it, ++pos)
+                reservoir.emplace_back(pos, *it);
+            if(pos == size_ && size_ > 0)
+            {
+                auto const m = static_cast<std::uint64_t>(size_);
+                double weight = detail::reservoir_weight(engine, static_cast<double>(m));
+                while(true)
+                {
+                    for(auto skip = detail::reservoir_skip(engine, weight);
+                        skip != 0 && it != last;
+                        --skip, ++pos)
+                        ++it;
+                    if(it == last)
+                        break;
+                    auto & slot = reservoir[detail::bounded_random(engine, m)];
+                    slot.first = pos;
+                    slot.second = *it;
+                    ++it;
+                    ++pos;
+                    weight *= detail::reservoir_weight(engine, static_cast<double>(m));
+                }
+                ranges::sort(reservoir, less{}, &std::pair<D, V>::first);
+            }
+            std::vector<V> & sample = sample_.emplace();
+            sample.reserve(reservoir.size());
+            for(auto & p : reservoir)
+                sample.push_back(std::move(p.second));
+        }
+
+        cursor begin_cursor()
+        {
+            if(!sample_)
+                fill_();
+            return cursor{this};
+        }
+
+    public:
+        reservoir_sample_view() = default;
+
+        explicit reservoir_sample_view(Rng rng, D sample_size, URNG & generator)
+          : rng_(std::move(rng))
+          , size_(sample_size)
+          , engine_(std::addressof(generator))
+        {
+            RANGES_EXPECT(sample_size >= 0);
+        }
+
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
     namespace views
     {
         /// Returns a random sample of a range of length `size(range)`.
@@ -228,6 +339,24 @@ namespace ranges
                     all(static_cast<Rng &&>(rng)), sample_size, generator};
             }
 
+            /// \overload
+            template(typename Rng, typename URNG = detail::default_random_engine)(
+                /// \pre
+                requires viewable_range<Rng> AND input_range<Rng> AND
+                    uniform_random_bit_generator<URNG> AND
+                    copy_constructible<range_value_t<Rng>> AND
+                    (!(sized_range<Rng> ||
+                       sized_sentinel_for<sentinel_t<Rng>, iterator_t<Rng>> ||
+                       forward_range<Rng>))) //
+            reservoir_sample_view<all_t<Rng>, URNG> operator()(
+                Rng && rng,
+                range_difference_t<Rng> sample_size,
+                URNG & generator = detail::get_random_engine()) const
+            {
+                return reservoir_sample_view<all_t<Rng>, URNG>{
+                    all(static_cast<Rng &&>(rng)), sample_size, generator};
+            }
+
             /// \cond
             template<typename Rng, typename URNG>
             invoke_result_t<sample_base_fn, Rng, range_difference_t<Rng>, URNG &> //
@@ -267,5 +396,6 @@ namespace ranges
 #include <range/v3/detail/epilogue.hpp>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 RANGES_SATISFY_BOOST_RANGE(::ranges::sample_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::reservoir_sample_view)
 
 #endif
@@ -38,6 +38,8 @@
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/view.hpp>
 
+#include <range/v3/detail/gallop.hpp>
+
 #include <range/v3/detail/prologue.hpp>
 
 namespace ranges
@@ -128,6 +130,9 @@ namespace ranges
 
             void satisfy()
             {
+                detail::gallop_mode mode;
+                // Whether *it2_ is known not to be less than *it1_
+                bool not_less2 = false;
                 while(it1_ != end1_)
                 {
                     if(it2_ == end2_)
@@ -136,10 +141,22 @@ namespace ranges
                     if(invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
                         return;
 
-                    if(!invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
+                    if(not_less2 ||
+                       !invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
+                    {
+                        mode.tie();
+                        not_less2 = false;
                         ++it1_;
-
-                    ++it2_;
+                        ++it2_;
+                    }
+                    else if(mode.win(2))
+                    {
+                        it2_ = mode.skip(
+                            std::move(it2_), end2_, invoke(proj1_, *it1_), pred_, proj2_);
+                        not_less2 = true;
+                    }
+                    else
+                        ++it2_;
                 }
             }
 
@@ -307,16 +324,35 @@ namespace ranges
 
             void satisfy()
             {
+                detail::gallop_mode mode;
+                // Whether *it2_ is known not to be less than *it1_
+                bool not_less2 = false;
                 while(it1_ != end1_ && it2_ != end2_)
                 {
                     if(invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
-                        ++it1_;
-                    else
                     {
-                        if(!invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
+                        not_less2 = false;
+                        if(!mode.win(1))
+                        {
+                            ++it1_;
+                            continue;
+                        }
+                        it1_ = mode.skip(
+                            std::move(it1_), end1_, invoke(proj2_, *it2_), pred_, proj1_);
+                        if(it1_ == end1_)
                             return;
-                        ++it2_;
                     }
+                    if(not_less2 ||
+                       !invoke(pred_, invoke(proj2_, *it2_), invoke(proj1_, *it1_)))
+                        return;
+                    if(mode.win(2))
+                    {
+                        it2_ = mode.skip(
+                            std::move(it2_), end2_, invoke(proj1_, *it1_), pred_, proj2_);
+                        not_less2 = true;
+                    }
+                    else
+                        ++it2_;
                 }
             }
 
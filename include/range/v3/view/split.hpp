@@ -22,6 +22,7 @@
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/mismatch.hpp>
+#include <range/v3/algorithm/search.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/access.hpp>
@@ -344,6 +345,27 @@ namespace ranges
             {
                 return (parent_->base_);
             }
+            template<typename I, typename S, typename PI>
+            static constexpr void skip_(I & current, S last, PI pbegin, PI pend,
+                                        std::true_type) // Forward
+            {
+                // Long patterns are found with a searcher
+                current = ranges::search(current, last, pbegin, pend).end();
+            }
+            template<typename I, typename S, typename PI>
+            static constexpr void skip_(I & current, S last, PI pbegin, PI pend,
+                                        std::false_type) // Input
+            {
+                do
+                {
+                    const auto ret = ranges::mismatch(current, last, pbegin, pend);
+                    if(ret.in2 == pend)
+                    {
+                        current = ret.in1; // The pattern matched; skip it
+                        break;
+                    }
+                } while(++current != last);
+            }
 #if RANGES_CXX_IF_CONSTEXPR < RANGES_CXX_IF_CONSTEXPR_17
             constexpr split_outer_iterator post_inc(std::true_type) // Forward
             {
@@ -430,15 +452,7 @@ namespace ranges
                 if(pbegin == pend)
                     ++current;
                 else
-                    do
-                    {
-                        const auto ret = ranges::mismatch(current, last, pbegin, pend);
-                        if(ret.in2 == pend)
-                        {
-                            current = ret.in1; // The pattern matched; skip it
-                            break;
-                        }
-                    } while(++current != last);
+                    skip_(current, last, pbegin, pend, meta::bool_<forward_range<Base>>{});
                 return *this;
             }
 
@@ -14,20 +14,28 @@
 #ifndef RANGES_V3_VIEW_TOKENIZE_HPP
 #define RANGES_V3_VIEW_TOKENIZE_HPP
 
+#include <cstdint>
 #include <initializer_list>
 #include <regex>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <meta/meta.hpp>
+
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/utility/semiregular_box.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
 #include <range/v3/view/interface.hpp>
+#include <range/v3/view/subrange.hpp>
 #include <range/v3/view/view.hpp>
 
 #include <range/v3/detail/prologue.hpp>
@@ -92,18 +100,233 @@ namespace ranges
         }
     };
 
+    // clang-format off
+    /// \concept token_matcher_
+    /// The \c token_matcher_ concept
+    template(typename Matcher, typename I, typename S)(
+    concept (token_matcher_)(Matcher, I, S),
+        convertible_to<invoke_result_t<Matcher const &, I, S>, subrange<I>>
+    );
+
+    /// \concept token_matcher
+    /// The \c token_matcher concept: called with a range <tt>[I, S)</tt>, a
+    /// \c Matcher returns the first token in it as a subrange, or an empty
+    /// subrange at the end of the range when there is none.
+    template<typename Matcher, typename I, typename S>
+    CPP_concept token_matcher =
+        forward_iterator<I> && sentinel_for<S, I> &&
+        invocable<Matcher const &, I, S> &&
+        CPP_concept_ref(ranges::token_matcher_, Matcher, I, S);
+    // clang-format on
+
+    /// A \c token_matcher for tokens separated by runs of any of a set of
+    /// delimiter characters, like \c std::strtok. Delimiters are looked up in
+    /// a 256-bit table.
+    struct delimiter_set
+    {
+    private:
+        std::uint64_t bits_[4] = {};
+
+        template<typename I>
+        using is_byte_iterator_ = meta::bool_<std::is_integral<iter_value_t<I>>::value &&
+                                              sizeof(iter_value_t<I>) == 1>;
+
+        constexpr void insert_(unsigned char c) noexcept
+        {
+            bits_[c / 64] |= std::uint64_t(1) << (c % 64);
+        }
+
+    public:
+        constexpr delimiter_set() = default;
+
+        /// The characters of the null-terminated string \c delims
+        constexpr explicit delimiter_set(char const * delims) noexcept
+        {
+            for(; *delims; ++delims)
+                insert_(static_cast<unsigned char>(*delims));
+        }
+
+        template(typename Rng)(
+            /// \pre
+            requires input_range<Rng> AND
+            (!std::is_array<meta::_t<std::remove_reference<Rng>>>::value) AND
+            convertible_to<range_reference_t<Rng>, char>)
+        constexpr explicit delimiter_set(Rng && delims)
+        {
+            for(auto && c : delims)
+                insert_(static_cast<unsigned char>(static_cast<char>(c)));
+        }
+
+        template(typename Char)(
+            /// \pre
+            requires std::is_integral<Char>::value AND (sizeof(Char) == 1))
+        constexpr bool contains(Char c) const noexcept
+        {
+            auto const u = static_cast<unsigned char>(c);
+            return (bits_[u / 64] >> (u % 64)) & 1u;
+        }
+
+        template(typename I, typename S)(
+            /// \pre
+            requires forward_iterator<I> AND sentinel_for<S, I> AND
+                is_byte_iterator_<I>::value)
+        subrange<I> operator()(I first, S last) const
+        {
+            while(first != last && contains(*first))
+                ++first;
+            I token = first;
+            while(first != last && !contains(*first))
+                ++first;
+            return {std::move(token), std::move(first)};
+        }
+    };
+
+    /// The tokens that a \c token_matcher finds in a range, as subranges of
+    /// it. Nothing is copied or allocated. A matcher that returns an empty
+    /// token is next called one element past it.
+    template<typename Rng, typename Matcher>
+    struct tokenize_matcher_view
+      : view_facade<tokenize_matcher_view<Rng, Matcher>,
+                    is_finite<Rng>::value ? finite : unknown>
+    {
+    private:
+        friend range_access;
+        CPP_assert(forward_range<Rng> && view_<Rng>);
+
+        Rng rng_;
+        semiregular_box_t<Matcher> matcher_;
+
+        template<bool IsConst>
+        struct cursor
+        {
+        private:
+            friend range_access;
+            friend struct cursor<!IsConst>;
+            using CRng = meta::const_if_c<IsConst, Rng>;
+            using matcher_ref_t = semiregular_box_ref_or_val_t<Matcher, IsConst>;
+            matcher_ref_t matcher_;
+            subrange<iterator_t<CRng>> token_;
+            sentinel_t<CRng> last_;
+
+            void find_(iterator_t<CRng> first)
+            {
+                token_ = invoke(matcher_, std::move(first), last_);
+            }
+            subrange<iterator_t<CRng>> read() const
+            {
+                return token_;
+            }
+            void next()
+            {
+                RANGES_EXPECT(token_.begin() != last_);
+                auto first = token_.end();
+                if(token_.empty())
+                    ++first;
+                find_(std::move(first));
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return token_.begin() == last_;
+            }
+            bool equal(cursor const & that) const
+            {
+                return token_.begin() == that.token_.begin();
+            }
+
+        public:
+            cursor() = default;
+            cursor(matcher_ref_t matcher, iterator_t<CRng> first, sentinel_t<CRng> last)
+              : matcher_(matcher)
+              , last_(std::move(last))
+            {
+                find_(std::move(first));
+            }
+            template(bool Other)(
+                /// \pre
+                requires IsConst AND CPP_NOT(Other) AND
+                convertible_to<iterator_t<Rng>, iterator_t<CRng>> AND
+                convertible_to<sentinel_t<Rng>, sentinel_t<CRng>>)
+            cursor(cursor<Other> that)
+              : matcher_(that.matcher_)
+              , token_(std::move(that.token_))
+              , last_(std::move(that.last_))
+            {}
+        };
+        cursor<false> begin_cursor()
+        {
+            return {matcher_, ranges::begin(rng_), ranges::end(rng_)};
+        }
+        template(bool Const = true)(
+            /// \pre
+            requires Const AND forward_range<meta::const_if_c<Const, Rng>> AND
+                token_matcher<Matcher, iterator_t<meta::const_if_c<Const, Rng>>,
+                              sentinel_t<meta::const_if_c<Const, Rng>>>)
+        cursor<Const> begin_cursor() const
+        {
+            return {matcher_, ranges::begin(rng_), ranges::end(rng_)};
+        }
+
+    public:
+        tokenize_matcher_view() = default;
+        tokenize_matcher_view(Rng rng, Matcher matcher)
+          : rng_(std::move(rng))
+          , matcher_(std::move(matcher))
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    /// \cond
+    namespace detail
+    {
+        template<typename T>
+        struct is_basic_regex : std::false_type
+        {};
+        template<typename Char, typename Traits>
+        struct is_basic_regex<std::basic_regex<Char, Traits>> : std::true_type
+        {};
+
+        // clang-format off
+        /// \concept tokenize_regex
+        /// The \c tokenize_regex concept: the regex argument of the closure
+        /// overloads of \c views::tokenize, as opposed to a \c token_matcher
+        template<typename Regex>
+        CPP_concept tokenize_regex = is_basic_regex<uncvref_t<Regex>>::value;
+        // clang-format on
+    } // namespace detail
+    /// \endcond
+
 #if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
     template(typename Rng, typename Regex, typename SubMatchRange)(
         /// \pre
         requires copy_constructible<Regex> AND copy_constructible<SubMatchRange>)
         tokenize_view(Rng &&, Regex, SubMatchRange)
             ->tokenize_view<views::all_t<Rng>, Regex, SubMatchRange>;
+
+    template(typename Rng, typename Matcher)(
+        /// \pre
+        requires copy_constructible<Matcher>)
+        tokenize_matcher_view(Rng &&, Matcher)
+            ->tokenize_matcher_view<views::all_t<Rng>, Matcher>;
 #endif
 
     namespace views
     {
         struct tokenize_base_fn
         {
+            template(typename Rng, typename Matcher)(
+                /// \pre
+                requires viewable_range<Rng> AND forward_range<Rng> AND
+                    copy_constructible<Matcher> AND
+                    token_matcher<Matcher, iterator_t<Rng>, sentinel_t<Rng>>)
+            tokenize_matcher_view<all_t<Rng>, Matcher> //
+            operator()(Rng && rng, Matcher matcher) const
+            {
+                return {all(static_cast<Rng &&>(rng)), std::move(matcher)};
+            }
+
             template(typename Rng, typename Regex)(
                 /// \pre
                 requires bidirectional_range<Rng> AND common_range<Rng> AND
@@ -166,7 +389,19 @@ namespace ranges
         {
             using tokenize_base_fn::operator();
 
-            template<typename Regex>
+            template(typename Matcher)(
+                /// \pre
+                requires (!detail::tokenize_regex<Matcher>) AND
+                    copy_constructible<Matcher>)
+            constexpr auto operator()(Matcher matcher) const
+            {
+                return make_view_closure(
+                    bind_back(tokenize_base_fn{}, std::move(matcher)));
+            }
+
+            template(typename Regex)(
+                /// \pre
+                requires detail::tokenize_regex<Regex>)
             constexpr auto operator()(Regex && rex,
                                       int sub = 0,
                                       std::regex_constants::match_flag_type flags =
@@ -176,7 +411,9 @@ namespace ranges
                     tokenize_base_fn{}, static_cast<Regex &&>(rex), sub, flags));
             }
 
-            template<typename Regex>
+            template(typename Regex)(
+                /// \pre
+                requires detail::tokenize_regex<Regex>)
             auto operator()(Regex && rex,
                             std::vector<int> subs,
                             std::regex_constants::match_flag_type flags =
@@ -188,7 +425,9 @@ namespace ranges
                                  flags);
             }
 
-            template<typename Regex>
+            template(typename Regex)(
+                /// \pre
+                requires detail::tokenize_regex<Regex>)
             constexpr auto operator()(Regex && rex,
                                       std::initializer_list<int> subs,
                                       std::regex_constants::match_flag_type flags =
@@ -209,5 +448,6 @@ namespace ranges
 #include <range/v3/detail/epilogue.hpp>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 RANGES_SATISFY_BOOST_RANGE(::ranges::tokenize_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::tokenize_matcher_view)
 
 #endif
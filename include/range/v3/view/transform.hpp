@@ -30,6 +30,7 @@
 #include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/semiregular_box.hpp>
@@ -190,6 +191,10 @@ namespace ranges
         {
             return ranges::size(this->base());
         }
+        constexpr size_hint_t size_hint() const
+        {
+            return ranges::size_hint(this->base());
+        }
     };
 
     template<typename Rng, typename Fun>
@@ -0,0 +1,205 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Abstraction penalty gate. Each canonical pipeline, "range_<name>", is
+// benchmarked against the loop a programmer would write by hand,
+// "loop_<name>". The program fails if any pipeline is slower than its loop by
+// more than the ratio given by --max_penalty (default 2), which catches
+// compiler upgrades or library changes that stop pipelines from inlining or
+// vectorizing. Every other flag is passed on to Google Benchmark.
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip_with.hpp>
+
+#include "suite.hpp"
+
+namespace
+{
+    auto const even = [](int i) { return i % 2 == 0; };
+    auto const square = [](int i) { return i * i; };
+
+    // The size every pair is measured at: big enough that the loop dominates,
+    // small enough that the inputs stay in cache.
+    constexpr std::int64_t gate_size = 1 << 14;
+
+    // Runs each case five times; the gate compares the fastest run of each,
+    // which is the least disturbed by whatever else the machine is doing.
+    void gate(benchmark::internal::Benchmark * b)
+    {
+        b->Arg(gate_size)->Repetitions(5);
+    }
+
+    // views::iota | views::filter | views::transform
+    RANGES_PERF_CASE_APPLY(range_iota_filter_transform, gate,
+        auto const n = static_cast<int>(w.ints.size());
+        return ranges::accumulate(ranges::views::iota(0, n) |
+                                      ranges::views::filter(even) |
+                                      ranges::views::transform(square),
+                                  0LL););
+    RANGES_PERF_CASE_APPLY(loop_iota_filter_transform, gate,
+        auto const n = static_cast<int>(w.ints.size());
+        long long r = 0;
+        for(int i = 0; i < n; ++i)
+            if(i % 2 == 0)
+                r += i * i;
+        return r;);
+
+    // container | views::filter | views::transform
+    RANGES_PERF_CASE_APPLY(range_filter_transform, gate,
+        return ranges::accumulate(w.ints | ranges::views::filter(even) |
+                                      ranges::views::transform(square),
+                                  0LL););
+    RANGES_PERF_CASE_APPLY(loop_filter_transform, gate,
+        long long r = 0;
+        for(int i : w.ints)
+            if(i % 2 == 0)
+                r += i * i;
+        return r;);
+
+    // container | views::transform
+    RANGES_PERF_CASE_APPLY(range_transform, gate,
+        return ranges::accumulate(w.ints | ranges::views::transform(square), 0LL););
+    RANGES_PERF_CASE_APPLY(loop_transform, gate,
+        long long r = 0;
+        for(int i : w.ints)
+            r += i * i;
+        return r;);
+
+    // views::zip_with, as a dot product
+    RANGES_PERF_CASE_APPLY(range_zip_with, gate,
+        return ranges::accumulate(
+            ranges::views::zip_with([](int a, int b) { return a * b; }, w.ints, w.sorted),
+            0LL););
+    RANGES_PERF_CASE_APPLY(loop_zip_with, gate,
+        long long r = 0;
+        for(std::size_t i = 0; i < w.ints.size(); ++i)
+            r += w.ints[i] * w.sorted[i];
+        return r;);
+
+    // container | views::reverse | views::take
+    RANGES_PERF_CASE_APPLY(range_reverse_take, gate,
+        auto const n = static_cast<std::ptrdiff_t>(w.ints.size() / 2);
+        return ranges::accumulate(w.ints | ranges::views::reverse | ranges::views::take(n),
+                                  0LL););
+    RANGES_PERF_CASE_APPLY(loop_reverse_take, gate,
+        long long r = 0;
+        for(std::size_t i = w.ints.size(), n = w.ints.size() / 2; n != 0; --n)
+            r += w.ints[--i];
+        return r;);
+
+    // container | views::stride
+    RANGES_PERF_CASE_APPLY(range_stride, gate,
+        return ranges::accumulate(w.ints | ranges::views::stride(3), 0LL););
+    RANGES_PERF_CASE_APPLY(loop_stride, gate,
+        long long r = 0;
+        for(std::size_t i = 0; i < w.ints.size(); i += 3)
+            r += w.ints[i];
+        return r;);
+
+    // nested containers | views::join
+    RANGES_PERF_CASE_APPLY(range_join, gate,
+        return ranges::accumulate(w.rows | ranges::views::join, 0LL););
+    RANGES_PERF_CASE_APPLY(loop_join, gate,
+        long long r = 0;
+        for(auto const & row : w.rows)
+            for(int i : row)
+                r += i;
+        return r;);
+
+    // Forwards to the console while keeping the fastest CPU time of each
+    // benchmark.
+    class recorder : public benchmark::ConsoleReporter
+    {
+    public:
+        std::map<std::string, double> best;
+
+        void ReportRuns(std::vector<Run> const & runs) override
+        {
+            for(auto const & run : runs)
+            {
+                if(run.run_type != Run::RT_Iteration || run.iterations == 0)
+                    continue;
+                auto name = run.run_name.function_name;
+                auto t = run.GetAdjustedCPUTime();
+                auto it = best.find(name);
+                if(it == best.end() || t < it->second)
+                    best[name] = t;
+            }
+            ConsoleReporter::ReportRuns(runs);
+        }
+    };
+
+    // Removes --max_penalty=X from the command line and returns X.
+    double take_max_penalty(int & argc, char ** argv)
+    {
+        static char const flag[] = "--max_penalty=";
+        double max_penalty = 2.0;
+        int out = 1;
+        for(int i = 1; i < argc; ++i)
+        {
+            if(std::strncmp(argv[i], flag, sizeof(flag) - 1) == 0)
+                max_penalty = std::atof(argv[i] + sizeof(flag) - 1);
+            else
+                argv[out++] = argv[i];
+        }
+        argc = out;
+        return max_penalty;
+    }
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    double const max_penalty = take_max_penalty(argc, argv);
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 2;
+
+    recorder rec;
+    benchmark::RunSpecifiedBenchmarks(&rec);
+    benchmark::Shutdown();
+
+    int failures = 0;
+    int pairs = 0;
+    std::cout << "\nAbstraction penalty (limit " << max_penalty << "x):\n";
+    for(auto const & kv : rec.best)
+    {
+        static std::string const prefix = "range_";
+        if(kv.first.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        auto loop = rec.best.find("loop_" + kv.first.substr(prefix.size()));
+        if(loop == rec.best.end() || loop->second <= 0)
+            continue;
+        double const ratio = kv.second / loop->second;
+        bool const ok = ratio <= max_penalty;
+        ++pairs;
+        failures += !ok;
+        std::cout << "  " << (ok ? "ok    " : "FAILED") << ' ' << kv.first << ": " << ratio
+                  << "x\n";
+    }
+    if(pairs == 0)
+        std::cout << "  no pairs ran\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,1034 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// One benchmark per algorithm, "alg_<name>", each paired with the standard
+// library equivalent, "std_<name>", or a hand-written loop where the standard
+// library has none. Run with --benchmark_out=algorithms.json
+// --benchmark_out_format=json to record results.
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <range/v3/algorithm.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/numeric.hpp>
+#include <range/v3/utility/eytzinger.hpp>
+#include <range/v3/view/reverse.hpp>
+
+#include "suite.hpp"
+
+namespace
+{
+    auto const even = [](int i) { return i % 2 == 0; };
+    auto const small = [](int i) { return i < 500; };
+    auto const twice = [](int i) { return 2 * i; };
+
+    // A needle that occurs near the end of the ints.
+    std::vector<int> needle(perf::workload const & w)
+    {
+        auto const n = w.ints.size();
+        return {w.ints.end() - static_cast<std::ptrdiff_t>(std::min<std::size_t>(n, 4)),
+                w.ints.end()};
+    }
+
+    // A longer needle that occurs near the end of the ints.
+    std::vector<int> long_needle(perf::workload const & w)
+    {
+        auto const n = w.ints.size();
+        return {w.ints.end() - static_cast<std::ptrdiff_t>(std::min<std::size_t>(n, 16)),
+                w.ints.end()};
+    }
+
+    // The first half of the sorted ints; a subsequence of sorted.
+    std::vector<int> const & sorted_half(perf::workload const & w)
+    {
+        thread_local std::vector<int> half;
+        half.assign(w.sorted.begin(),
+                    w.sorted.begin() + static_cast<std::ptrdiff_t>(w.sorted.size() / 2));
+        return half;
+    }
+
+    // Every n/64th of the sorted ints; a short list to intersect with a long one.
+    std::vector<int> const & sorted_sparse(perf::workload const & w)
+    {
+        thread_local std::vector<int> sparse;
+        sparse.clear();
+        auto const step = std::max<std::size_t>(1, w.sorted.size() / 64);
+        for(std::size_t i = 0; i < w.sorted.size(); i += step)
+            sparse.push_back(w.sorted[i]);
+        return sparse;
+    }
+
+    // The lookups, sorted, as the probe side of a sort-merge join sees them.
+    std::vector<int> const & sorted_lookups(perf::workload const & w)
+    {
+        thread_local std::vector<int> keys;
+        keys.assign(w.lookups.begin(), w.lookups.end());
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    // The sorted ints in Eytzinger order.
+    ranges::eytzinger_array<int> const & sorted_eytzinger(perf::workload const & w)
+    {
+        thread_local perf::workload const * from = nullptr;
+        thread_local ranges::eytzinger_array<int> arr;
+        if(from != &w)
+        {
+            from = &w;
+            arr = ranges::eytzinger_array<int>{w.sorted};
+        }
+        return arr;
+    }
+
+    // The ints in 64 sorted runs, as the last phase of an external sort sees them.
+    std::vector<std::vector<int>> const & sorted_runs(perf::workload const & w)
+    {
+        thread_local perf::workload const * from = nullptr;
+        thread_local std::vector<std::vector<int>> runs;
+        if(from != &w)
+        {
+            from = &w;
+            runs.assign(64, {});
+            for(std::size_t i = 0; i < w.ints.size(); ++i)
+                runs[i % 64].push_back(w.ints[i]);
+            for(auto & run : runs)
+                std::sort(run.begin(), run.end());
+        }
+        return runs;
+    }
+
+    long long checksum(std::vector<int> const & v)
+    {
+        return v.empty() ? 0 : v.front() + 3LL * v[v.size() / 2] + 7LL * v.back();
+    }
+} // namespace
+
+// Non-modifying sequence operations
+
+RANGES_PERF_CASE(alg_adjacent_find,
+    return ranges::adjacent_find(w.ints) - w.ints.begin(););
+RANGES_PERF_CASE(std_adjacent_find,
+    return std::adjacent_find(w.ints.begin(), w.ints.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_all_of,
+    return ranges::all_of(w.ints, [](int i) { return i >= 0; }););
+RANGES_PERF_CASE(std_all_of,
+    return std::all_of(w.ints.begin(), w.ints.end(), [](int i) { return i >= 0; }););
+
+RANGES_PERF_CASE(alg_any_of,
+    return ranges::any_of(w.ints, [](int i) { return i < 0; }););
+RANGES_PERF_CASE(std_any_of,
+    return std::any_of(w.ints.begin(), w.ints.end(), [](int i) { return i < 0; }););
+
+RANGES_PERF_CASE(alg_none_of,
+    return ranges::none_of(w.ints, [](int i) { return i < 0; }););
+RANGES_PERF_CASE(std_none_of,
+    return std::none_of(w.ints.begin(), w.ints.end(), [](int i) { return i < 0; }););
+
+RANGES_PERF_CASE(alg_contains,
+    return ranges::contains(w.ints, -1););
+RANGES_PERF_CASE(std_contains,
+    return std::find(w.ints.begin(), w.ints.end(), -1) != w.ints.end(););
+
+RANGES_PERF_CASE(alg_count,
+    return ranges::count(w.ints, 7););
+RANGES_PERF_CASE(std_count,
+    return std::count(w.ints.begin(), w.ints.end(), 7););
+
+RANGES_PERF_CASE(alg_count_if,
+    return ranges::count_if(w.ints, even););
+RANGES_PERF_CASE(std_count_if,
+    return std::count_if(w.ints.begin(), w.ints.end(), even););
+
+RANGES_PERF_CASE(alg_ends_with,
+    return ranges::ends_with(w.ints, needle(w)););
+RANGES_PERF_CASE(std_ends_with,
+    auto const n = needle(w);
+    return w.ints.size() >= n.size() &&
+           std::equal(n.begin(), n.end(), w.ints.end() - static_cast<std::ptrdiff_t>(n.size())););
+
+RANGES_PERF_CASE(alg_equal,
+    return ranges::equal(w.ints, w.ints););
+RANGES_PERF_CASE(std_equal,
+    return std::equal(w.ints.begin(), w.ints.end(), w.ints.begin(), w.ints.end()););
+
+RANGES_PERF_CASE(alg_find,
+    return ranges::find(w.ints, -1) - w.ints.begin(););
+RANGES_PERF_CASE(std_find,
+    return std::find(w.ints.begin(), w.ints.end(), -1) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_find_end,
+    return ranges::find_end(w.ints, needle(w)).begin() - w.ints.begin(););
+RANGES_PERF_CASE(std_find_end,
+    auto const n = needle(w);
+    return std::find_end(w.ints.begin(), w.ints.end(), n.begin(), n.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_find_first_of,
+    int const set[] = {-1, -2, -3, -4};
+    return ranges::find_first_of(w.ints, set) - w.ints.begin(););
+RANGES_PERF_CASE(std_find_first_of,
+    int const set[] = {-1, -2, -3, -4};
+    return std::find_first_of(w.ints.begin(), w.ints.end(), set, set + 4) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_find_if,
+    return ranges::find_if(w.ints, [](int i) { return i < 0; }) - w.ints.begin(););
+RANGES_PERF_CASE(std_find_if,
+    return std::find_if(w.ints.begin(), w.ints.end(), [](int i) { return i < 0; }) -
+           w.ints.begin(););
+
+RANGES_PERF_CASE(alg_find_if_not,
+    return ranges::find_if_not(w.ints, [](int i) { return i >= 0; }) - w.ints.begin(););
+RANGES_PERF_CASE(std_find_if_not,
+    return std::find_if_not(w.ints.begin(), w.ints.end(), [](int i) { return i >= 0; }) -
+           w.ints.begin(););
+
+RANGES_PERF_CASE(alg_for_each,
+    long long r = 0;
+    ranges::for_each(w.ints, [&r](int i) { r += i; });
+    return r;);
+RANGES_PERF_CASE(std_for_each,
+    long long r = 0;
+    std::for_each(w.ints.begin(), w.ints.end(), [&r](int i) { r += i; });
+    return r;);
+
+RANGES_PERF_CASE(alg_for_each_n,
+    long long r = 0;
+    ranges::for_each_n(w.ints.begin(), static_cast<std::ptrdiff_t>(w.ints.size()),
+                       [&r](int i) { r += i; });
+    return r;);
+RANGES_PERF_CASE(std_for_each_n,
+    long long r = 0;
+    auto it = w.ints.begin();
+    for(std::size_t n = w.ints.size(); n != 0; --n, ++it)
+        r += *it;
+    return r;);
+
+RANGES_PERF_CASE(alg_lexicographical_compare,
+    return ranges::lexicographical_compare(w.ints, w.ints););
+RANGES_PERF_CASE(std_lexicographical_compare,
+    return std::lexicographical_compare(w.ints.begin(), w.ints.end(),
+                                        w.ints.begin(), w.ints.end()););
+
+RANGES_PERF_CASE(alg_mismatch,
+    return ranges::mismatch(w.ints, w.ints).in1 - w.ints.begin(););
+RANGES_PERF_CASE(std_mismatch,
+    return std::mismatch(w.ints.begin(), w.ints.end(), w.ints.begin(), w.ints.end()).first -
+           w.ints.begin(););
+
+RANGES_PERF_CASE(alg_search,
+    return ranges::search(w.ints, needle(w)).begin() - w.ints.begin(););
+RANGES_PERF_CASE(std_search,
+    auto const n = needle(w);
+    return std::search(w.ints.begin(), w.ints.end(), n.begin(), n.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_search_long,
+    return ranges::search(w.ints, long_needle(w)).begin() - w.ints.begin(););
+RANGES_PERF_CASE(std_search_long,
+    auto const n = long_needle(w);
+    return std::search(w.ints.begin(), w.ints.end(), n.begin(), n.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_find_end_long,
+    return ranges::find_end(w.ints, long_needle(w)).begin() - w.ints.begin(););
+RANGES_PERF_CASE(std_find_end_long,
+    auto const n = long_needle(w);
+    return std::find_end(w.ints.begin(), w.ints.end(), n.begin(), n.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_search_n,
+    return ranges::search_n(w.sorted, 3, 999).begin() - w.sorted.begin(););
+RANGES_PERF_CASE(std_search_n,
+    return std::search_n(w.sorted.begin(), w.sorted.end(), 3, 999) - w.sorted.begin(););
+
+RANGES_PERF_CASE(alg_starts_with,
+    return ranges::starts_with(w.ints, w.ints););
+RANGES_PERF_CASE(std_starts_with,
+    return std::equal(w.ints.begin(), w.ints.end(), w.ints.begin()););
+
+// Modifying sequence operations
+
+RANGES_PERF_CASE(alg_copy,
+    s.a.resize(w.ints.size());
+    ranges::copy(w.ints, s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_copy,
+    s.a.resize(w.ints.size());
+    std::copy(w.ints.begin(), w.ints.end(), s.a.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_copy_backward,
+    s.a.resize(w.ints.size());
+    ranges::copy_backward(w.ints, s.a.end());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_copy_backward,
+    s.a.resize(w.ints.size());
+    std::copy_backward(w.ints.begin(), w.ints.end(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_copy_if,
+    s.a.clear();
+    ranges::copy_if(w.ints, ranges::back_inserter(s.a), even);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_copy_if,
+    s.a.clear();
+    std::copy_if(w.ints.begin(), w.ints.end(), std::back_inserter(s.a), even);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_copy_n,
+    s.a.resize(w.ints.size());
+    ranges::copy_n(w.ints.begin(), static_cast<std::ptrdiff_t>(w.ints.size()), s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_copy_n,
+    s.a.resize(w.ints.size());
+    std::copy_n(w.ints.begin(), w.ints.size(), s.a.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_fill,
+    s.a.resize(w.ints.size());
+    ranges::fill(s.a, 7);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_fill,
+    s.a.resize(w.ints.size());
+    std::fill(s.a.begin(), s.a.end(), 7);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_fill_n,
+    s.a.resize(w.ints.size());
+    ranges::fill_n(s.a.begin(), static_cast<std::ptrdiff_t>(s.a.size()), 7);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_fill_n,
+    s.a.resize(w.ints.size());
+    std::fill_n(s.a.begin(), s.a.size(), 7);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_generate,
+    s.a.resize(w.ints.size());
+    ranges::generate(s.a, [i = 0]() mutable { return i++; });
+    return checksum(s.a););
+RANGES_PERF_CASE(std_generate,
+    s.a.resize(w.ints.size());
+    std::generate(s.a.begin(), s.a.end(), [i = 0]() mutable { return i++; });
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_generate_n,
+    s.a.resize(w.ints.size());
+    ranges::generate_n(s.a.begin(), static_cast<std::ptrdiff_t>(s.a.size()),
+                       [i = 0]() mutable { return i++; });
+    return checksum(s.a););
+RANGES_PERF_CASE(std_generate_n,
+    s.a.resize(w.ints.size());
+    std::generate_n(s.a.begin(), s.a.size(), [i = 0]() mutable { return i++; });
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_move,
+    s.a = w.ints;
+    s.b.resize(s.a.size());
+    ranges::move(s.a, s.b.begin());
+    return checksum(s.b););
+RANGES_PERF_CASE(std_move,
+    s.a = w.ints;
+    s.b.resize(s.a.size());
+    std::move(s.a.begin(), s.a.end(), s.b.begin());
+    return checksum(s.b););
+
+RANGES_PERF_CASE(alg_move_backward,
+    s.a = w.ints;
+    s.b.resize(s.a.size());
+    ranges::move_backward(s.a, s.b.end());
+    return checksum(s.b););
+RANGES_PERF_CASE(std_move_backward,
+    s.a = w.ints;
+    s.b.resize(s.a.size());
+    std::move_backward(s.a.begin(), s.a.end(), s.b.end());
+    return checksum(s.b););
+
+RANGES_PERF_CASE(alg_remove,
+    s.a = w.ints;
+    return ranges::remove(s.a, 7) - s.a.begin(););
+RANGES_PERF_CASE(std_remove,
+    s.a = w.ints;
+    return std::remove(s.a.begin(), s.a.end(), 7) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_remove_if,
+    s.a = w.ints;
+    return ranges::remove_if(s.a, even) - s.a.begin(););
+RANGES_PERF_CASE(std_remove_if,
+    s.a = w.ints;
+    return std::remove_if(s.a.begin(), s.a.end(), even) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_unstable_remove_if,
+    s.a = w.ints;
+    return ranges::unstable_remove_if(s.a, even) - s.a.begin(););
+RANGES_PERF_CASE(std_unstable_remove_if,
+    s.a = w.ints;
+    return std::remove_if(s.a.begin(), s.a.end(), even) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_adjacent_remove_if,
+    s.a = w.sorted;
+    return ranges::adjacent_remove_if(s.a, std::equal_to<>{}) - s.a.begin(););
+RANGES_PERF_CASE(std_adjacent_remove_if,
+    s.a = w.sorted;
+    return std::unique(s.a.begin(), s.a.end()) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_remove_copy,
+    s.a.clear();
+    ranges::remove_copy(w.ints, ranges::back_inserter(s.a), 7);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_remove_copy,
+    s.a.clear();
+    std::remove_copy(w.ints.begin(), w.ints.end(), std::back_inserter(s.a), 7);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_remove_copy_if,
+    s.a.clear();
+    ranges::remove_copy_if(w.ints, ranges::back_inserter(s.a), even);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_remove_copy_if,
+    s.a.clear();
+    std::remove_copy_if(w.ints.begin(), w.ints.end(), std::back_inserter(s.a), even);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_replace,
+    s.a = w.ints;
+    ranges::replace(s.a, 7, 8);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_replace,
+    s.a = w.ints;
+    std::replace(s.a.begin(), s.a.end(), 7, 8);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_replace_if,
+    s.a = w.ints;
+    ranges::replace_if(s.a, even, 0);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_replace_if,
+    s.a = w.ints;
+    std::replace_if(s.a.begin(), s.a.end(), even, 0);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_replace_copy,
+    s.a.resize(w.ints.size());
+    ranges::replace_copy(w.ints, s.a.begin(), 7, 8);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_replace_copy,
+    s.a.resize(w.ints.size());
+    std::replace_copy(w.ints.begin(), w.ints.end(), s.a.begin(), 7, 8);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_replace_copy_if,
+    s.a.resize(w.ints.size());
+    ranges::replace_copy_if(w.ints, s.a.begin(), even, 0);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_replace_copy_if,
+    s.a.resize(w.ints.size());
+    std::replace_copy_if(w.ints.begin(), w.ints.end(), s.a.begin(), even, 0);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_reverse,
+    s.a = w.ints;
+    ranges::reverse(s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_reverse,
+    s.a = w.ints;
+    std::reverse(s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_reverse_copy,
+    s.a.resize(w.ints.size());
+    ranges::reverse_copy(w.ints, s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_reverse_copy,
+    s.a.resize(w.ints.size());
+    std::reverse_copy(w.ints.begin(), w.ints.end(), s.a.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_rotate,
+    s.a = w.ints;
+    ranges::rotate(s.a, s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 3));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_rotate,
+    s.a = w.ints;
+    std::rotate(s.a.begin(), s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 3),
+                s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_rotate_copy,
+    s.a.resize(w.ints.size());
+    ranges::rotate_copy(w.ints, w.ints.begin() + static_cast<std::ptrdiff_t>(w.ints.size() / 3),
+                        s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_rotate_copy,
+    s.a.resize(w.ints.size());
+    std::rotate_copy(w.ints.begin(),
+                     w.ints.begin() + static_cast<std::ptrdiff_t>(w.ints.size() / 3),
+                     w.ints.end(), s.a.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_sample,
+    std::mt19937 gen{42};
+    s.a.resize(w.ints.size() / 2);
+    ranges::sample(w.ints, s.a.begin(), static_cast<std::ptrdiff_t>(s.a.size()), gen);
+    return s.a.size(););
+RANGES_PERF_CASE(std_sample,
+    // Selection sampling, which is what std::sample does on forward ranges.
+    std::mt19937 gen{42};
+    s.a.resize(w.ints.size() / 2);
+    auto out = s.a.begin();
+    auto n = static_cast<std::ptrdiff_t>(s.a.size());
+    auto left = static_cast<std::ptrdiff_t>(w.ints.size());
+    for(auto it = w.ints.begin(); n != 0; ++it, --left)
+    {
+        std::uniform_int_distribution<std::ptrdiff_t> dist{0, left - 1};
+        if(dist(gen) < n)
+        {
+            *out++ = *it;
+            --n;
+        }
+    }
+    return s.a.size(););
+
+RANGES_PERF_CASE(alg_shuffle,
+    std::mt19937 gen{42};
+    s.a = w.ints;
+    ranges::shuffle(s.a, gen);
+    return s.a.size(););
+RANGES_PERF_CASE(std_shuffle,
+    std::mt19937 gen{42};
+    s.a = w.ints;
+    std::shuffle(s.a.begin(), s.a.end(), gen);
+    return s.a.size(););
+
+RANGES_PERF_CASE(alg_swap_ranges,
+    s.a = w.ints;
+    s.b = w.sorted;
+    ranges::swap_ranges(s.a, s.b);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_swap_ranges,
+    s.a = w.ints;
+    s.b = w.sorted;
+    std::swap_ranges(s.a.begin(), s.a.end(), s.b.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_transform,
+    s.a.resize(w.ints.size());
+    ranges::transform(w.ints, s.a.begin(), twice);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_transform,
+    s.a.resize(w.ints.size());
+    std::transform(w.ints.begin(), w.ints.end(), s.a.begin(), twice);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_unique,
+    s.a = w.sorted;
+    return ranges::unique(s.a) - s.a.begin(););
+RANGES_PERF_CASE(std_unique,
+    s.a = w.sorted;
+    return std::unique(s.a.begin(), s.a.end()) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_unique_copy,
+    s.a.clear();
+    ranges::unique_copy(w.sorted, ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_unique_copy,
+    s.a.clear();
+    std::unique_copy(w.sorted.begin(), w.sorted.end(), std::back_inserter(s.a));
+    return checksum(s.a););
+
+// Partitioning operations
+
+RANGES_PERF_CASE(alg_is_partitioned,
+    return ranges::is_partitioned(w.sorted, small););
+RANGES_PERF_CASE(std_is_partitioned,
+    return std::is_partitioned(w.sorted.begin(), w.sorted.end(), small););
+
+RANGES_PERF_CASE(alg_partition,
+    s.a = w.ints;
+    return ranges::partition(s.a, even) - s.a.begin(););
+RANGES_PERF_CASE(std_partition,
+    s.a = w.ints;
+    return std::partition(s.a.begin(), s.a.end(), even) - s.a.begin(););
+
+RANGES_PERF_CASE(alg_partition_copy,
+    s.a.clear();
+    s.b.clear();
+    ranges::partition_copy(w.ints, ranges::back_inserter(s.a), ranges::back_inserter(s.b), even);
+    return checksum(s.a) + checksum(s.b););
+RANGES_PERF_CASE(std_partition_copy,
+    s.a.clear();
+    s.b.clear();
+    std::partition_copy(w.ints.begin(), w.ints.end(), std::back_inserter(s.a),
+                        std::back_inserter(s.b), even);
+    return checksum(s.a) + checksum(s.b););
+
+RANGES_PERF_CASE(alg_partition_point,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += ranges::partition_point(w.sorted, [k](int i) { return i < k; }) - w.sorted.begin();
+    return r;);
+RANGES_PERF_CASE(std_partition_point,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += std::partition_point(w.sorted.begin(), w.sorted.end(),
+                                  [k](int i) { return i < k; }) -
+             w.sorted.begin();
+    return r;);
+
+RANGES_PERF_CASE(alg_stable_partition,
+    s.a = w.ints;
+    return ranges::stable_partition(s.a, even) - s.a.begin(););
+RANGES_PERF_CASE(std_stable_partition,
+    s.a = w.ints;
+    return std::stable_partition(s.a.begin(), s.a.end(), even) - s.a.begin(););
+
+// Sorting operations
+
+RANGES_PERF_CASE(alg_is_sorted,
+    return ranges::is_sorted(w.sorted););
+RANGES_PERF_CASE(std_is_sorted,
+    return std::is_sorted(w.sorted.begin(), w.sorted.end()););
+
+RANGES_PERF_CASE(alg_is_sorted_until,
+    return ranges::is_sorted_until(w.sorted) - w.sorted.begin(););
+RANGES_PERF_CASE(std_is_sorted_until,
+    return std::is_sorted_until(w.sorted.begin(), w.sorted.end()) - w.sorted.begin(););
+
+RANGES_PERF_CASE(alg_nth_element,
+    s.a = w.ints;
+    auto nth = s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 2);
+    ranges::nth_element(s.a, nth);
+    return *nth;);
+RANGES_PERF_CASE(std_nth_element,
+    s.a = w.ints;
+    auto nth = s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 2);
+    std::nth_element(s.a.begin(), nth, s.a.end());
+    return *nth;);
+
+RANGES_PERF_CASE(alg_partial_sort,
+    s.a = w.ints;
+    ranges::partial_sort(s.a, s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 8));
+    return s.a.front(););
+RANGES_PERF_CASE(std_partial_sort,
+    s.a = w.ints;
+    std::partial_sort(s.a.begin(), s.a.begin() + static_cast<std::ptrdiff_t>(s.a.size() / 8),
+                      s.a.end());
+    return s.a.front(););
+
+RANGES_PERF_CASE(alg_partial_sort_copy,
+    s.a.resize(w.ints.size() / 8);
+    ranges::partial_sort_copy(w.ints, s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_partial_sort_copy,
+    s.a.resize(w.ints.size() / 8);
+    std::partial_sort_copy(w.ints.begin(), w.ints.end(), s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_sort,
+    s.a = w.ints;
+    ranges::sort(s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_sort,
+    s.a = w.ints;
+    std::sort(s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_radix_sort,
+    s.a = w.ints;
+    ranges::radix_sort(s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_radix_sort,
+    s.a = w.ints;
+    std::stable_sort(s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_stable_sort,
+    s.a = w.ints;
+    ranges::stable_sort(s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_stable_sort,
+    s.a = w.ints;
+    std::stable_sort(s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+// Binary search operations, 1024 lookups each
+
+RANGES_PERF_CASE(alg_binary_search,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += ranges::binary_search(w.sorted, k);
+    return r;);
+RANGES_PERF_CASE(std_binary_search,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += std::binary_search(w.sorted.begin(), w.sorted.end(), k);
+    return r;);
+
+RANGES_PERF_CASE(alg_equal_range,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += ranges::distance(ranges::equal_range(w.sorted, k));
+    return r;);
+RANGES_PERF_CASE(std_equal_range,
+    long long r = 0;
+    for(int k : w.lookups)
+    {
+        auto p = std::equal_range(w.sorted.begin(), w.sorted.end(), k);
+        r += p.second - p.first;
+    }
+    return r;);
+
+RANGES_PERF_CASE(alg_lower_bound,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += ranges::lower_bound(w.sorted, k) - w.sorted.begin();
+    return r;);
+RANGES_PERF_CASE(std_lower_bound,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += std::lower_bound(w.sorted.begin(), w.sorted.end(), k) - w.sorted.begin();
+    return r;);
+
+// The lookups of alg_lower_bound, in the sorted ints laid out in Eytzinger order.
+RANGES_PERF_CASE(alg_eytzinger_lower_bound,
+    long long r = 0;
+    auto const & arr = sorted_eytzinger(w);
+    for(int k : w.lookups)
+        r += arr.lower_bound(k) != arr.end();
+    return r;);
+
+// Batches of lookups against one lower_bound per lookup.
+RANGES_PERF_CASE(alg_lower_bound_sorted,
+    long long r = 0;
+    for(int k : sorted_lookups(w))
+        r += ranges::lower_bound(w.sorted, k) - w.sorted.begin();
+    return r;);
+RANGES_PERF_CASE(alg_lower_bound_many,
+    long long r = 0;
+    auto const & keys = sorted_lookups(w);
+    std::vector<std::vector<int>::const_iterator> its(keys.size());
+    ranges::lower_bound_many(w.sorted, keys, its.begin());
+    for(auto it : its)
+        r += it - w.sorted.begin();
+    return r;);
+RANGES_PERF_CASE(alg_lower_bound_batch,
+    long long r = 0;
+    std::vector<std::vector<int>::const_iterator> its(w.lookups.size());
+    ranges::lower_bound_batch(w.sorted, w.lookups, its.begin());
+    for(auto it : its)
+        r += it - w.sorted.begin();
+    return r;);
+
+RANGES_PERF_CASE(alg_upper_bound,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += ranges::upper_bound(w.sorted, k) - w.sorted.begin();
+    return r;);
+RANGES_PERF_CASE(std_upper_bound,
+    long long r = 0;
+    for(int k : w.lookups)
+        r += std::upper_bound(w.sorted.begin(), w.sorted.end(), k) - w.sorted.begin();
+    return r;);
+
+// Set operations on sorted ranges
+
+RANGES_PERF_CASE(alg_includes,
+    return ranges::includes(w.sorted, sorted_half(w)););
+RANGES_PERF_CASE(std_includes,
+    auto const & half = sorted_half(w);
+    return std::includes(w.sorted.begin(), w.sorted.end(), half.begin(), half.end()););
+
+RANGES_PERF_CASE(alg_inplace_merge,
+    s.a = w.sorted;
+    s.a.insert(s.a.end(), w.sorted2.begin(), w.sorted2.end());
+    ranges::inplace_merge(s.a, s.a.begin() + static_cast<std::ptrdiff_t>(w.sorted.size()));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_inplace_merge,
+    s.a = w.sorted;
+    s.a.insert(s.a.end(), w.sorted2.begin(), w.sorted2.end());
+    std::inplace_merge(s.a.begin(), s.a.begin() + static_cast<std::ptrdiff_t>(w.sorted.size()),
+                       s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_merge,
+    s.a.resize(2 * w.sorted.size());
+    ranges::merge(w.sorted, w.sorted2, s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_merge,
+    s.a.resize(2 * w.sorted.size());
+    std::merge(w.sorted.begin(), w.sorted.end(), w.sorted2.begin(), w.sorted2.end(),
+               s.a.begin());
+    return checksum(s.a););
+
+// A tournament tree against a binary heap of the runs' fronts.
+RANGES_PERF_CASE(alg_merge_k,
+    s.a.resize(w.ints.size());
+    ranges::merge_k(sorted_runs(w), s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_merge_k,
+    using front = std::pair<int, std::size_t>;
+    auto const & runs = sorted_runs(w);
+    std::vector<std::size_t> pos(runs.size(), 0);
+    std::vector<front> heap;
+    for(std::size_t i = 0; i < runs.size(); ++i)
+        if(!runs[i].empty())
+            heap.emplace_back(runs[i][0], i);
+    std::make_heap(heap.begin(), heap.end(), std::greater<front>{});
+    s.a.clear();
+    while(!heap.empty())
+    {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<front>{});
+        auto const i = heap.back().second;
+        s.a.push_back(heap.back().first);
+        heap.pop_back();
+        if(++pos[i] != runs[i].size())
+        {
+            heap.emplace_back(runs[i][pos[i]], i);
+            std::push_heap(heap.begin(), heap.end(), std::greater<front>{});
+        }
+    }
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_set_difference,
+    s.a.clear();
+    ranges::set_difference(w.sorted, w.sorted2, ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_set_difference,
+    s.a.clear();
+    std::set_difference(w.sorted.begin(), w.sorted.end(), w.sorted2.begin(), w.sorted2.end(),
+                        std::back_inserter(s.a));
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_set_intersection,
+    s.a.clear();
+    ranges::set_intersection(w.sorted, w.sorted2, ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_set_intersection,
+    s.a.clear();
+    std::set_intersection(w.sorted.begin(), w.sorted.end(), w.sorted2.begin(),
+                          w.sorted2.end(), std::back_inserter(s.a));
+    return checksum(s.a););
+
+// A short list against a long one, which is galloped over.
+RANGES_PERF_CASE(alg_set_difference_skewed,
+    s.a.clear();
+    ranges::set_difference(sorted_sparse(w), w.sorted, ranges::back_inserter(s.a));
+    return checksum(s.a) + static_cast<long long>(s.a.size()););
+RANGES_PERF_CASE(std_set_difference_skewed,
+    s.a.clear();
+    auto const & sparse = sorted_sparse(w);
+    std::set_difference(sparse.begin(), sparse.end(), w.sorted.begin(), w.sorted.end(),
+                        std::back_inserter(s.a));
+    return checksum(s.a) + static_cast<long long>(s.a.size()););
+
+RANGES_PERF_CASE(alg_set_intersection_skewed,
+    s.a.clear();
+    ranges::set_intersection(w.sorted, sorted_sparse(w), ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_set_intersection_skewed,
+    s.a.clear();
+    auto const & sparse = sorted_sparse(w);
+    std::set_intersection(w.sorted.begin(), w.sorted.end(), sparse.begin(), sparse.end(),
+                          std::back_inserter(s.a));
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_set_symmetric_difference,
+    s.a.clear();
+    ranges::set_symmetric_difference(w.sorted, w.sorted2, ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_set_symmetric_difference,
+    s.a.clear();
+    std::set_symmetric_difference(w.sorted.begin(), w.sorted.end(), w.sorted2.begin(),
+                                  w.sorted2.end(), std::back_inserter(s.a));
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_set_union,
+    s.a.clear();
+    ranges::set_union(w.sorted, w.sorted2, ranges::back_inserter(s.a));
+    return checksum(s.a););
+RANGES_PERF_CASE(std_set_union,
+    s.a.clear();
+    std::set_union(w.sorted.begin(), w.sorted.end(), w.sorted2.begin(), w.sorted2.end(),
+                   std::back_inserter(s.a));
+    return checksum(s.a););
+
+// Heap operations
+
+RANGES_PERF_CASE(alg_make_heap,
+    s.a = w.ints;
+    ranges::make_heap(s.a);
+    return s.a.front(););
+RANGES_PERF_CASE(std_make_heap,
+    s.a = w.ints;
+    std::make_heap(s.a.begin(), s.a.end());
+    return s.a.front(););
+
+RANGES_PERF_CASE(alg_push_heap,
+    s.a.clear();
+    for(int i : w.ints)
+    {
+        s.a.push_back(i);
+        ranges::push_heap(s.a);
+    }
+    return s.a.front(););
+RANGES_PERF_CASE(std_push_heap,
+    s.a.clear();
+    for(int i : w.ints)
+    {
+        s.a.push_back(i);
+        std::push_heap(s.a.begin(), s.a.end());
+    }
+    return s.a.front(););
+
+RANGES_PERF_CASE(alg_sort_heap,
+    s.a = w.sorted;
+    std::reverse(s.a.begin(), s.a.end()); // a max-heap
+    ranges::sort_heap(s.a);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_sort_heap,
+    s.a = w.sorted;
+    std::reverse(s.a.begin(), s.a.end());
+    std::sort_heap(s.a.begin(), s.a.end());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_pop_heap,
+    s.a = w.sorted;
+    std::reverse(s.a.begin(), s.a.end());
+    for(auto e = s.a.end(); e != s.a.begin(); --e)
+        ranges::pop_heap(s.a.begin(), e);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_pop_heap,
+    s.a = w.sorted;
+    std::reverse(s.a.begin(), s.a.end());
+    for(auto e = s.a.end(); e != s.a.begin(); --e)
+        std::pop_heap(s.a.begin(), e);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_is_heap,
+    return ranges::is_heap(w.sorted | ranges::views::reverse););
+RANGES_PERF_CASE(std_is_heap,
+    return std::is_heap(w.sorted.rbegin(), w.sorted.rend()););
+
+RANGES_PERF_CASE(alg_is_heap_until,
+    return ranges::is_heap_until(w.ints) - w.ints.begin(););
+RANGES_PERF_CASE(std_is_heap_until,
+    return std::is_heap_until(w.ints.begin(), w.ints.end()) - w.ints.begin(););
+
+// Minimum/maximum operations
+
+RANGES_PERF_CASE(alg_max,
+    return ranges::max(w.ints););
+RANGES_PERF_CASE(std_max,
+    return *std::max_element(w.ints.begin(), w.ints.end()););
+
+RANGES_PERF_CASE(alg_max_element,
+    return ranges::max_element(w.ints) - w.ints.begin(););
+RANGES_PERF_CASE(std_max_element,
+    return std::max_element(w.ints.begin(), w.ints.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_min,
+    return ranges::min(w.ints););
+RANGES_PERF_CASE(std_min,
+    return *std::min_element(w.ints.begin(), w.ints.end()););
+
+RANGES_PERF_CASE(alg_min_element,
+    return ranges::min_element(w.ints) - w.ints.begin(););
+RANGES_PERF_CASE(std_min_element,
+    return std::min_element(w.ints.begin(), w.ints.end()) - w.ints.begin(););
+
+RANGES_PERF_CASE(alg_minmax,
+    auto r = ranges::minmax(w.ints);
+    return r.min * 1000LL + r.max;);
+RANGES_PERF_CASE(std_minmax,
+    auto r = std::minmax_element(w.ints.begin(), w.ints.end());
+    return *r.first * 1000LL + *r.second;);
+
+RANGES_PERF_CASE(alg_minmax_element,
+    auto r = ranges::minmax_element(w.ints);
+    return (r.min - w.ints.begin()) * 1000000LL + (r.max - w.ints.begin()););
+RANGES_PERF_CASE(std_minmax_element,
+    auto r = std::minmax_element(w.ints.begin(), w.ints.end());
+    return (r.first - w.ints.begin()) * 1000000LL + (r.second - w.ints.begin()););
+
+// Permutation operations
+
+RANGES_PERF_CASE(alg_is_permutation,
+    return ranges::is_permutation(w.ints, w.ints););
+RANGES_PERF_CASE(std_is_permutation,
+    return std::is_permutation(w.ints.begin(), w.ints.end(), w.ints.begin(), w.ints.end()););
+
+RANGES_PERF_CASE(alg_next_permutation,
+    s.a = w.ints;
+    long long r = 0;
+    for(int i = 0; i < 64; ++i)
+        r += ranges::next_permutation(s.a);
+    return r + checksum(s.a););
+RANGES_PERF_CASE(std_next_permutation,
+    s.a = w.ints;
+    long long r = 0;
+    for(int i = 0; i < 64; ++i)
+        r += std::next_permutation(s.a.begin(), s.a.end());
+    return r + checksum(s.a););
+
+RANGES_PERF_CASE(alg_prev_permutation,
+    s.a = w.ints;
+    long long r = 0;
+    for(int i = 0; i < 64; ++i)
+        r += ranges::prev_permutation(s.a);
+    return r + checksum(s.a););
+RANGES_PERF_CASE(std_prev_permutation,
+    s.a = w.ints;
+    long long r = 0;
+    for(int i = 0; i < 64; ++i)
+        r += std::prev_permutation(s.a.begin(), s.a.end());
+    return r + checksum(s.a););
+
+// Numeric operations
+
+RANGES_PERF_CASE(alg_accumulate,
+    return ranges::accumulate(w.ints, 0LL););
+RANGES_PERF_CASE(std_accumulate,
+    return std::accumulate(w.ints.begin(), w.ints.end(), 0LL););
+
+RANGES_PERF_CASE(alg_adjacent_difference,
+    s.a.resize(w.ints.size());
+    ranges::adjacent_difference(w.ints, s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_adjacent_difference,
+    s.a.resize(w.ints.size());
+    std::adjacent_difference(w.ints.begin(), w.ints.end(), s.a.begin());
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_inner_product,
+    return ranges::inner_product(w.ints, w.sorted, 0LL););
+RANGES_PERF_CASE(std_inner_product,
+    return std::inner_product(w.ints.begin(), w.ints.end(), w.sorted.begin(), 0LL););
+
+RANGES_PERF_CASE(alg_iota,
+    s.a.resize(w.ints.size());
+    ranges::iota(s.a, 0);
+    return checksum(s.a););
+RANGES_PERF_CASE(std_iota,
+    s.a.resize(w.ints.size());
+    std::iota(s.a.begin(), s.a.end(), 0);
+    return checksum(s.a););
+
+RANGES_PERF_CASE(alg_partial_sum,
+    s.a.resize(w.ints.size());
+    ranges::partial_sum(w.ints, s.a.begin());
+    return checksum(s.a););
+RANGES_PERF_CASE(std_partial_sum,
+    s.a.resize(w.ints.size());
+    std::partial_sum(w.ints.begin(), w.ints.end(), s.a.begin());
+    return checksum(s.a););
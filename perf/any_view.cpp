@@ -0,0 +1,194 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost of iterating an any_view and of creating and copying its
+// iterators, which allocate unless the erased cursor fits in the iterator's
+// inline buffer (see RANGES_ANY_VIEW_CURSOR_BUFFER_SIZE), of the algorithms
+// that walk a contiguous any_view through a pointer, and of
+// ranges::for_each_buffered, which reads other any_views in blocks.
+
+#include <list>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_buffered.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/any_view.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take_exactly.hpp>
+
+namespace
+{
+    using forward_ints = ranges::any_view<int, ranges::category::forward>;
+
+    std::vector<int> make_vector(benchmark::State const & state)
+    {
+        std::vector<int> v(static_cast<std::size_t>(state.range(0)));
+        std::iota(v.begin(), v.end(), 0);
+        return v;
+    }
+
+    void iterate_vector(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        for(auto _ : state)
+        {
+            int sum = 0;
+            for(int i : v)
+                sum += i;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void iterate_any_view(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        forward_ints rng = v;
+        for(auto _ : state)
+        {
+            int sum = 0;
+            for(auto it = rng.begin(); it != rng.end(); ++it)
+                sum += *it;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void iterate_any_view_iota(benchmark::State & state)
+    {
+        forward_ints rng = ranges::views::iota(0) |
+                           ranges::views::take_exactly(static_cast<int>(state.range(0)));
+        for(auto _ : state)
+        {
+            int sum = 0;
+            for(auto it = rng.begin(); it != rng.end(); ++it)
+                sum += *it;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void begin_any_view(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        forward_ints rng = v;
+        for(auto _ : state)
+        {
+            auto it = rng.begin();
+            benchmark::DoNotOptimize(it);
+        }
+    }
+
+    // Copies an iterator once per element, as a multipass algorithm might.
+    void copy_any_view_iterator(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        forward_ints rng = v;
+        for(auto _ : state)
+        {
+            int sum = 0;
+            auto const e = rng.end();
+            for(auto it = rng.begin(); it != e; ++it)
+            {
+                auto tmp = it;
+                sum += *tmp;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void accumulate_any_view(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        forward_ints rng = v;
+        for(auto _ : state)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, 0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void accumulate_any_view_list(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        std::list<int> const l(v.begin(), v.end());
+        forward_ints rng = l;
+        for(auto _ : state)
+            benchmark::DoNotOptimize(ranges::accumulate(rng, 0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void for_each_any_view_iota(benchmark::State & state)
+    {
+        forward_ints rng = ranges::views::iota(0) |
+                           ranges::views::take_exactly(static_cast<int>(state.range(0)));
+        for(auto _ : state)
+        {
+            int sum = 0;
+            ranges::for_each(rng, [&sum](int i) { sum += i; });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void for_each_buffered_any_view_iota(benchmark::State & state)
+    {
+        forward_ints rng = ranges::views::iota(0) |
+                           ranges::views::take_exactly(static_cast<int>(state.range(0)));
+        for(auto _ : state)
+        {
+            int sum = 0;
+            ranges::for_each_buffered(rng, [&sum](int i) { sum += i; });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void for_each_buffered_any_view_list(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        std::list<int> const l(v.begin(), v.end());
+        forward_ints rng = l;
+        for(auto _ : state)
+        {
+            int sum = 0;
+            ranges::for_each_buffered(rng, [&sum](int i) { sum += i; });
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void to_vector_any_view(benchmark::State & state)
+    {
+        auto const v = make_vector(state);
+        forward_ints rng = v;
+        for(auto _ : state)
+            benchmark::DoNotOptimize(rng | ranges::to<std::vector>());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(iterate_vector)->Range(8, 1 << 16);
+BENCHMARK(iterate_any_view)->Range(8, 1 << 16);
+BENCHMARK(iterate_any_view_iota)->Range(8, 1 << 16);
+BENCHMARK(begin_any_view)->Arg(8);
+BENCHMARK(copy_any_view_iterator)->Range(8, 1 << 16);
+BENCHMARK(accumulate_any_view)->Range(8, 1 << 16);
+BENCHMARK(accumulate_any_view_list)->Range(8, 1 << 16);
+BENCHMARK(for_each_any_view_iota)->Range(8, 1 << 16);
+BENCHMARK(for_each_buffered_any_view_iota)->Range(8, 1 << 16);
+BENCHMARK(for_each_buffered_any_view_list)->Range(8, 1 << 16);
+BENCHMARK(to_vector_any_view)->Range(8, 1 << 16);
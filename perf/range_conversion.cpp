@@ -22,9 +22,16 @@
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/common.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/transform.hpp>
 
+#if RANGES_CXX_STD >= RANGES_CXX_STD_17 && __has_include(<memory_resource>)
+#include <memory_resource>
+#define RANGES_PERF_PMR 1
+#endif
+
 using namespace ranges;
 
 namespace
@@ -99,3 +106,55 @@ BENCHMARK_F(Words, RangeTo)(benchmark::State & st)
         benchmark::ClobberMemory();
     }
 }
+
+namespace
+{
+    // A request-scoped workload: many small containers of strings that live
+    // only as long as the request, materialized with make.
+    template<typename Make>
+    std::size_t serve_request(Make make)
+    {
+        static char const text[] = "the quick brown fox jumps over the lazy dog, twice";
+        std::size_t n = 0;
+        for(int i = 0; i < 64; ++i)
+        {
+            auto v = make(views::iota(i, i + 16) |
+                          views::transform([](int j) { return text + j % 8; }));
+            benchmark::DoNotOptimize(v.data());
+            n += v.size();
+        }
+        return n;
+    }
+} // namespace
+
+static void RequestDefaultAllocator(benchmark::State & st)
+{
+    for(auto _ : st)
+    {
+        auto n = ::serve_request([](auto && rng) {
+            return static_cast<decltype(rng)>(rng) |
+                   ranges::to<std::vector<std::string>>();
+        });
+        benchmark::DoNotOptimize(n);
+    }
+}
+BENCHMARK(RequestDefaultAllocator);
+
+#ifdef RANGES_PERF_PMR
+// The same workload with every container and string in one arena, which is
+// released at the end of the request.
+static void RequestMonotonicBuffer(benchmark::State & st)
+{
+    std::vector<unsigned char> buffer(1 << 17);
+    for(auto _ : st)
+    {
+        std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+        auto n = ::serve_request([&arena](auto && rng) {
+            return static_cast<decltype(rng)>(rng) |
+                   ranges::to<std::pmr::vector<std::pmr::string>>(&arena);
+        });
+        benchmark::DoNotOptimize(n);
+    }
+}
+BENCHMARK(RequestMonotonicBuffer);
+#endif
@@ -92,6 +92,22 @@ namespace
     }
   };
 
+  struct sawtooth_integer_sequence {
+    static std::string name() { return "sawtooth_integer_sequence"; }
+    auto operator()(std::size_t) {
+      return ranges::views::ints(0, 1000) | ranges::views::cycle;
+    }
+  };
+
+  struct many_duplicates_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist{0, 15};
+    auto operator()(std::size_t) {
+      return ranges::views::generate([&]{ return dist(gen); });
+    }
+    static std::string name() { return "many_duplicates_integer_sequence"; }
+  };
+
   template<typename Seq>
   void print(Seq seq, std::size_t n) {
     std::cout << "sequence: " << seq.name() << '\n';
@@ -202,30 +218,52 @@ namespace
                                               max_size);
   }
 
+  /// ranges::sort with the introsort engine it had before pdqsort
+  struct introsort_fn {
+    template<typename Rng>
+    void operator()(Rng &&rng) const {
+      auto first = ranges::begin(rng);
+      auto last = ranges::end(rng);
+      ranges::less pred;
+      ranges::identity proj;
+      if (first != last)
+        ranges::detail::introsort(first, last, pred, proj);
+    }
+  };
+
   template<typename Seq> void benchmark_sort(Seq &&seq, std::size_t max_size) {
     auto ranges_sort_comp =
         make_computation_on_sequence(seq, ranges::sort, max_size);
 
+    auto introsort_comp =
+        make_computation_on_sequence(seq, introsort_fn{}, max_size);
+
     auto std_sort_comp = make_computation_on_sequence(
         seq, [](auto &&v) { std::sort(std::begin(v), std::end(v)); }, max_size);
 
     auto ranges_sort_benchmark =
         benchmark(ranges_sort_comp, geometric_sequence_n(2, max_size));
 
+    auto introsort_benchmark =
+        benchmark(introsort_comp, geometric_sequence_n(2, max_size));
+
     auto std_sort_benchmark =
         benchmark(std_sort_comp, geometric_sequence_n(2, max_size));
     using std::setw;
     std::cout << '#'
               << "pattern: " << seq.name() << '\n';
     std::cout << '#' << setw(19) << 'N' << setw(20) << "ranges::sort" << setw(20)
-              << "std::sort"
+              << "introsort" << setw(20) << "std::sort"
               << '\n';
     RANGES_FOR(auto p, ranges::views::zip(ranges_sort_benchmark.results,
+                                         introsort_benchmark.results,
                                          std_sort_benchmark.results)) {
-      auto rs = p.first;
-      auto ss = p.second;
+      auto rs = std::get<0>(p);
+      auto is = std::get<1>(p);
+      auto ss = std::get<2>(p);
 
       std::cout << setw(20) << rs.size << setw(20) << to_millis(rs.mean_t)
+                << setw(20) << to_millis(is.mean_t)
                 << setw(20) << to_millis(ss.mean_t) << '\n';
     }
   }
@@ -240,11 +278,15 @@ int main()
   print(descending_integer_sequence(), 20);
   print(even_odd_integer_sequence(), 20);
   print(organ_pipe_integer_sequence(), 20);
+  print(sawtooth_integer_sequence(), 20);
+  print(many_duplicates_integer_sequence(), 20);
 
   benchmark_sort(random_uniform_integer_sequence(), max_size);
   benchmark_sort(ascending_integer_sequence(), max_size);
   benchmark_sort(descending_integer_sequence(), max_size);
   benchmark_sort(organ_pipe_integer_sequence(), max_size);
+  benchmark_sort(sawtooth_integer_sequence(), max_size);
+  benchmark_sort(many_duplicates_integer_sequence(), max_size);
 }
 
 #else
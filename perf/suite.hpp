@@ -0,0 +1,175 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Shared harness for the view and algorithm benchmark suites. Every benchmark
+// is registered under a name of the form "<kind>_<what>/<size>", where kind is
+// "view" or "alg" for the range-v3 version and "loop" or "std" for the
+// hand-written or standard library baseline, so that results can be paired up
+// by name.
+
+#ifndef RANGES_PERF_SUITE_HPP
+#define RANGES_PERF_SUITE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/range/access.hpp>
+
+namespace perf
+{
+    // The inputs every benchmark of a given size draws from. Built once per
+    // size and shared.
+    struct workload
+    {
+        std::vector<int> ints;        // uniform in [0, 1000)
+        std::vector<int> sorted;      // ints, sorted
+        std::vector<int> sorted2;     // another sorted sequence of the same size
+        std::vector<int> lookups;     // 1024 keys to search for in sorted
+        std::vector<int const *> ptrs;
+        std::vector<std::vector<int>> rows; // ints in rows of 16
+        std::vector<std::array<int, 4>> quads; // ints in groups of 4
+        std::vector<std::pair<int, int>> pairs;
+        std::string digits;           // ints as decimal digits, space separated
+        std::string lines;            // ints, one per line
+
+        explicit workload(std::size_t n)
+        {
+            std::mt19937 gen{static_cast<std::uint32_t>(n)};
+            std::uniform_int_distribution<int> dist{0, 999};
+            ints.resize(n);
+            for(int & i : ints)
+                i = dist(gen);
+            sorted = ints;
+            std::sort(sorted.begin(), sorted.end());
+            sorted2.resize(n);
+            for(int & i : sorted2)
+                i = dist(gen);
+            std::sort(sorted2.begin(), sorted2.end());
+            lookups.resize(1024);
+            for(int & i : lookups)
+                i = dist(gen);
+            for(int const & i : ints)
+                ptrs.push_back(&i);
+            for(std::size_t i = 0; i < n; i += 16)
+                rows.emplace_back(ints.begin() + static_cast<std::ptrdiff_t>(i),
+                                  ints.begin() +
+                                      static_cast<std::ptrdiff_t>(std::min(n, i + 16)));
+            for(std::size_t i = 0; i + 4 <= n; i += 4)
+                quads.push_back({{ints[i], ints[i + 1], ints[i + 2], ints[i + 3]}});
+            for(int i : ints)
+                pairs.emplace_back(i, -i);
+            for(int i : ints)
+            {
+                digits += std::to_string(i);
+                digits += ' ';
+                lines += std::to_string(i);
+                lines += '\n';
+            }
+        }
+
+        static workload const & get(std::int64_t n)
+        {
+            static std::map<std::int64_t, std::unique_ptr<workload>> cache;
+            auto & w = cache[n];
+            if(!w)
+                w.reset(new workload{static_cast<std::size_t>(n)});
+            return *w;
+        }
+    };
+
+    // Scratch space for algorithms that write. Every benchmark of a mutating
+    // algorithm copies its input here first, whichever version it measures, so
+    // the copy cost cancels out of the comparison.
+    struct scratch
+    {
+        std::vector<int> a;
+        std::vector<int> b;
+    };
+
+    // Runs f(workload const &, scratch &) once per iteration. f returns
+    // something observable so that the work cannot be optimized away.
+    template<typename F>
+    void run(benchmark::State & state, F f)
+    {
+        auto const & w = workload::get(state.range(0));
+        scratch s;
+        s.a.reserve(w.ints.size() * 2);
+        s.b.reserve(w.ints.size() * 2);
+        for(auto _ : state)
+        {
+            auto r = f(w, s);
+            benchmark::DoNotOptimize(r);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // The sizes every benchmark is run at.
+    inline void sizes(benchmark::internal::Benchmark * b)
+    {
+        b->RangeMultiplier(16)->Range(1 << 6, 1 << 18);
+    }
+
+    // Sums the elements of a range by walking its iterators, so that only the
+    // range's own iteration is measured.
+    template<typename Rng>
+    long long sum(Rng && rng)
+    {
+        long long s = 0;
+        auto last = ranges::end(rng);
+        for(auto it = ranges::begin(rng); it != last; ++it)
+            s += *it;
+        return s;
+    }
+
+    // Like sum(rng), but sums f(x) for each element x.
+    template<typename Rng, typename F>
+    auto sum(Rng && rng, F f) -> decltype(f(*ranges::begin(rng)))
+    {
+        decltype(f(*ranges::begin(rng))) s{};
+        auto last = ranges::end(rng);
+        for(auto it = ranges::begin(rng); it != last; ++it)
+            s += f(*it);
+        return s;
+    }
+} // namespace perf
+
+/// Defines and registers a benchmark named NAME. The remaining macro
+/// arguments are the statements of its body, which see the inputs as `w` and
+/// the scratch space as `s` and must return a value.
+#define RANGES_PERF_CASE(NAME, ...) \
+    RANGES_PERF_CASE_APPLY(NAME, ::perf::sizes, __VA_ARGS__) /**/
+
+/// Like RANGES_PERF_CASE, but the benchmark is configured by APPLY, a
+/// function taking the benchmark::internal::Benchmark *, instead of being run
+/// at the usual sizes.
+#define RANGES_PERF_CASE_APPLY(NAME, APPLY, ...)                                \
+    void NAME(benchmark::State & state)                                         \
+    {                                                                           \
+        ::perf::run(state, [](::perf::workload const & w, ::perf::scratch & s) { \
+            (void)w;                                                            \
+            (void)s;                                                            \
+            __VA_ARGS__                                                         \
+        });                                                                     \
+    }                                                                           \
+    BENCHMARK(NAME)->Apply(APPLY) /**/
+
+#endif
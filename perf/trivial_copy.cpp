@@ -0,0 +1,125 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares ranges::copy, ranges::move and ranges::fill, which lower to
+// memmove/memset for contiguous ranges of trivially copyable type, against
+// an element-by-element loop and the standard library.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/move.hpp>
+
+namespace
+{
+    template<typename T>
+    void copy_loop(benchmark::State & state)
+    {
+        std::vector<T> src(static_cast<std::size_t>(state.range(0)), T(1));
+        std::vector<T> dst(src.size());
+        for(auto _ : state)
+        {
+            auto out = dst.begin();
+            for(auto it = src.begin(); it != src.end(); ++it, ++out)
+                *out = *it;
+            benchmark::DoNotOptimize(dst.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) *
+                                static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void copy_ranges(benchmark::State & state)
+    {
+        std::vector<T> src(static_cast<std::size_t>(state.range(0)), T(1));
+        std::vector<T> dst(src.size());
+        for(auto _ : state)
+        {
+            ranges::copy(src, dst.begin());
+            benchmark::DoNotOptimize(dst.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) *
+                                static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void copy_std(benchmark::State & state)
+    {
+        std::vector<T> src(static_cast<std::size_t>(state.range(0)), T(1));
+        std::vector<T> dst(src.size());
+        for(auto _ : state)
+        {
+            std::copy(src.begin(), src.end(), dst.begin());
+            benchmark::DoNotOptimize(dst.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) *
+                                static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    template<typename T>
+    void move_ranges(benchmark::State & state)
+    {
+        std::vector<T> src(static_cast<std::size_t>(state.range(0)), T(1));
+        std::vector<T> dst(src.size());
+        for(auto _ : state)
+        {
+            ranges::move(src, dst.begin());
+            benchmark::DoNotOptimize(dst.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) *
+                                static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    void fill_loop(benchmark::State & state)
+    {
+        std::vector<char> v(static_cast<std::size_t>(state.range(0)));
+        for(auto _ : state)
+        {
+            for(auto it = v.begin(); it != v.end(); ++it)
+                *it = 'x';
+            benchmark::DoNotOptimize(v.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void fill_ranges(benchmark::State & state)
+    {
+        std::vector<char> v(static_cast<std::size_t>(state.range(0)));
+        for(auto _ : state)
+        {
+            ranges::fill(v, 'x');
+            benchmark::DoNotOptimize(v.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(copy_loop, int)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(copy_ranges, int)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(copy_std, int)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(move_ranges, int)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(copy_loop, char)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(copy_ranges, char)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(copy_std, char)->Range(16, 1 << 20);
+BENCHMARK(fill_loop)->Range(16, 1 << 20);
+BENCHMARK(fill_ranges)->Range(16, 1 << 20);
@@ -0,0 +1,909 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// One benchmark per view adaptor, "view_<name>", each paired with a
+// hand-written loop computing the same thing, "loop_<name>". Run with
+// --benchmark_out=views.json --benchmark_out_format=json to record results.
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view.hpp>
+
+#include "suite.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    auto const even = [](int i) { return i % 2 == 0; };
+    auto const twice = [](int i) { return 2 * i; };
+    auto const small = [](int i) { return i < 500; };
+    auto const same_hundred = [](int a, int b) { return a / 100 == b / 100; };
+
+    template<typename Rng>
+    long long sum_sizes(Rng && rng)
+    {
+        long long s = 0;
+        for(auto it = ranges::begin(rng), e = ranges::end(rng); it != e; ++it)
+            s += perf::sum(*it);
+        return s;
+    }
+} // namespace
+
+RANGES_PERF_CASE(view_addressof,
+    return perf::sum(w.ints | views::addressof,
+                     [](int const * p) { return static_cast<long long>(*p); }););
+RANGES_PERF_CASE(loop_addressof,
+    long long r = 0;
+    for(int const & i : w.ints)
+        r += *&i;
+    return r;);
+
+RANGES_PERF_CASE(view_adjacent_filter,
+    return perf::sum(w.ints | views::adjacent_filter(std::less<>{})););
+RANGES_PERF_CASE(loop_adjacent_filter,
+    long long r = w.ints.empty() ? 0 : w.ints[0];
+    for(std::size_t i = 1; i < w.ints.size(); ++i)
+        if(w.ints[i - 1] < w.ints[i])
+            r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_adjacent_remove_if,
+    return perf::sum(w.sorted | views::adjacent_remove_if(std::equal_to<>{})););
+RANGES_PERF_CASE(loop_adjacent_remove_if,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.sorted.size(); ++i)
+        if(i + 1 == w.sorted.size() || w.sorted[i] != w.sorted[i + 1])
+            r += w.sorted[i];
+    return r;);
+
+RANGES_PERF_CASE(view_all,
+    return perf::sum(views::all(w.ints)););
+RANGES_PERF_CASE(loop_all,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_any_view,
+    any_view<int const &, category::random_access> rng = w.ints;
+    return perf::sum(rng););
+RANGES_PERF_CASE(loop_any_view,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_buffered_getlines,
+    std::istringstream is{w.lines};
+    return perf::sum(buffered_getlines(is), [](subrange<char const *> line) {
+        return static_cast<long long>(line.size());
+    }););
+RANGES_PERF_CASE(loop_buffered_getlines,
+    std::istringstream is{w.lines};
+    long long r = 0;
+    std::string line;
+    while(std::getline(is, line))
+        r += static_cast<long long>(line.size());
+    return r;);
+
+RANGES_PERF_CASE(view_buffered_istream,
+    std::istringstream is{w.digits};
+    return perf::sum(buffered_istream<int>(is)););
+RANGES_PERF_CASE(loop_buffered_istream,
+    long long r = 0;
+    char const * p = w.digits.c_str();
+    char * end = nullptr;
+    for(long i = std::strtol(p, &end, 10); end != p; i = std::strtol(p, &end, 10))
+    {
+        r += i;
+        p = end;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_c_str,
+    return perf::sum(views::c_str(w.digits.c_str())););
+RANGES_PERF_CASE(loop_c_str,
+    long long r = 0;
+    for(char const * p = w.digits.c_str(); *p; ++p)
+        r += *p;
+    return r;);
+
+RANGES_PERF_CASE(view_cache1,
+    return perf::sum(w.ints | views::transform(twice) | views::cache1 |
+                     views::filter(even)););
+RANGES_PERF_CASE(loop_cache1,
+    long long r = 0;
+    for(int i : w.ints)
+    {
+        int const j = twice(i);
+        if(even(j))
+            r += j;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_cartesian_product,
+    auto const n = static_cast<std::ptrdiff_t>(w.ints.size() / 32);
+    return perf::sum(views::cartesian_product(w.ints | views::take(32),
+                                              w.ints | views::take(n)),
+                     [](auto t) {
+                         return static_cast<long long>(std::get<0>(t) ^ std::get<1>(t));
+                     }););
+RANGES_PERF_CASE(loop_cartesian_product,
+    auto const n = w.ints.size() / 32;
+    long long r = 0;
+    for(std::size_t i = 0; i < 32; ++i)
+        for(std::size_t j = 0; j < n; ++j)
+            r += w.ints[i] ^ w.ints[j];
+    return r;);
+
+RANGES_PERF_CASE(view_chunk,
+    return sum_sizes(w.ints | views::chunk(16)););
+RANGES_PERF_CASE(loop_chunk,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); i += 16)
+        for(std::size_t j = i; j < std::min(i + 16, w.ints.size()); ++j)
+            r += w.ints[j];
+    return r;);
+
+RANGES_PERF_CASE(view_common,
+    return perf::sum(w.ints | views::take_while(small) | views::common););
+RANGES_PERF_CASE(loop_common,
+    long long r = 0;
+    for(int i : w.ints)
+    {
+        if(!small(i))
+            break;
+        r += i;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_concat,
+    return perf::sum(views::concat(w.ints, w.sorted)););
+RANGES_PERF_CASE(loop_concat,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i;
+    for(int i : w.sorted)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_const,
+    return perf::sum(w.ints | views::const_););
+RANGES_PERF_CASE(loop_const,
+    long long r = 0;
+    for(int const & i : w.ints)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_counted,
+    return perf::sum(views::counted(w.ints.begin(),
+                                    static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_counted,
+    long long r = 0;
+    auto it = w.ints.begin();
+    for(std::size_t n = w.ints.size(); n != 0; --n, ++it)
+        r += *it;
+    return r;);
+
+RANGES_PERF_CASE(view_cycle,
+    return perf::sum(w.ints | views::cycle |
+                     views::take(static_cast<std::ptrdiff_t>(2 * w.ints.size()))););
+RANGES_PERF_CASE(loop_cycle,
+    long long r = 0;
+    for(std::size_t i = 0; i < 2 * w.ints.size(); ++i)
+        r += w.ints[i % w.ints.size()];
+    return r;);
+
+RANGES_PERF_CASE(view_delimit,
+    return perf::sum(views::delimit(w.ints.data(), 1000) |
+                     views::take(static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_delimit,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size() && w.ints[i] != 1000; ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_drop,
+    return perf::sum(w.ints | views::drop(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_drop,
+    long long r = 0;
+    for(std::size_t i = w.ints.size() / 2; i < w.ints.size(); ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_drop_exactly,
+    return perf::sum(w.ints |
+                     views::drop_exactly(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_drop_exactly,
+    long long r = 0;
+    for(std::size_t i = w.ints.size() / 2; i < w.ints.size(); ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_drop_last,
+    return perf::sum(w.ints |
+                     views::drop_last(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_drop_last,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size() - w.ints.size() / 2; ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_drop_while,
+    return perf::sum(w.sorted | views::drop_while(small)););
+RANGES_PERF_CASE(loop_drop_while,
+    long long r = 0;
+    auto it = w.sorted.begin();
+    while(it != w.sorted.end() && small(*it))
+        ++it;
+    for(; it != w.sorted.end(); ++it)
+        r += *it;
+    return r;);
+
+RANGES_PERF_CASE(view_empty,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += perf::sum(views::empty<int>);
+    return r;);
+RANGES_PERF_CASE(loop_empty,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        benchmark::DoNotOptimize(r);
+    return r;);
+
+RANGES_PERF_CASE(view_enumerate,
+    return perf::sum(w.ints | views::enumerate, [](auto p) {
+        return static_cast<long long>(p.first) * p.second;
+    }););
+RANGES_PERF_CASE(loop_enumerate,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += static_cast<long long>(i) * w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_exclusive_scan,
+    return perf::sum(w.ints | views::exclusive_scan(0)););
+RANGES_PERF_CASE(loop_exclusive_scan,
+    long long r = 0;
+    int acc = 0;
+    for(int i : w.ints)
+    {
+        r += acc;
+        acc += i;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_filter,
+    return perf::sum(w.ints | views::filter(even)););
+RANGES_PERF_CASE(loop_filter,
+    long long r = 0;
+    for(int i : w.ints)
+        if(even(i))
+            r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_for_each,
+    return perf::sum(w.ints | views::for_each([](int i) { return yield_if(even(i), i); })););
+RANGES_PERF_CASE(loop_for_each,
+    long long r = 0;
+    for(int i : w.ints)
+        if(even(i))
+            r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_generate,
+    return perf::sum(views::generate([i = 0]() mutable { return i++; }) |
+                     views::take(static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_generate,
+    long long r = 0;
+    for(int i = 0; i < static_cast<int>(w.ints.size()); ++i)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_generate_n,
+    return perf::sum(views::generate_n([i = 0]() mutable { return i++; },
+                                       static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_generate_n,
+    long long r = 0;
+    for(int i = 0; i < static_cast<int>(w.ints.size()); ++i)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_getlines,
+    std::istringstream is{w.lines};
+    return perf::sum(getlines(is), [](std::string const & line) {
+        return static_cast<long long>(line.size());
+    }););
+RANGES_PERF_CASE(loop_getlines,
+    std::istringstream is{w.lines};
+    long long r = 0;
+    std::string line;
+    while(std::getline(is, line))
+        r += static_cast<long long>(line.size());
+    return r;);
+
+RANGES_PERF_CASE(view_group_by,
+    return sum_sizes(w.sorted | views::group_by(same_hundred)););
+RANGES_PERF_CASE(loop_group_by,
+    long long r = 0;
+    for(int i : w.sorted)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_indices,
+    return perf::sum(views::indices(static_cast<int>(w.ints.size()))););
+RANGES_PERF_CASE(loop_indices,
+    long long r = 0;
+    for(int i = 0; i < static_cast<int>(w.ints.size()); ++i)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_indirect,
+    return perf::sum(w.ptrs | views::indirect););
+RANGES_PERF_CASE(loop_indirect,
+    long long r = 0;
+    for(int const * p : w.ptrs)
+        r += *p;
+    return r;);
+
+RANGES_PERF_CASE(view_intersperse,
+    return perf::sum(w.ints | views::intersperse(1)););
+RANGES_PERF_CASE(loop_intersperse,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += w.ints[i] + (i != 0 ? 1 : 0);
+    return r;);
+
+RANGES_PERF_CASE(view_iota,
+    return perf::sum(views::iota(0, static_cast<int>(w.ints.size()))););
+RANGES_PERF_CASE(loop_iota,
+    long long r = 0;
+    for(int i = 0; i < static_cast<int>(w.ints.size()); ++i)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_istream,
+    std::istringstream is{w.digits};
+    return perf::sum(istream<int>(is)););
+RANGES_PERF_CASE(loop_istream,
+    std::istringstream is{w.digits};
+    long long r = 0;
+    int i;
+    while(is >> i)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_join,
+    return perf::sum(w.rows | views::join););
+RANGES_PERF_CASE(loop_join,
+    long long r = 0;
+    for(auto const & row : w.rows)
+        for(int i : row)
+            r += i;
+    return r;);
+
+// Algorithms on a join run their inner loop on each row, where find and
+// count are vectorized and copy is a memmove.
+RANGES_PERF_CASE(view_join_find,
+    auto rng = w.rows | views::join;
+    return *ranges::find(rng, w.ints.back()););
+RANGES_PERF_CASE(loop_join_find,
+    for(auto const & row : w.rows)
+        for(int i : row)
+            if(i == w.ints.back())
+                return i;
+    return 0;);
+RANGES_PERF_CASE(view_join_count,
+    return ranges::count(w.rows | views::join, w.ints.front()););
+RANGES_PERF_CASE(loop_join_count,
+    long long r = 0;
+    for(auto const & row : w.rows)
+        for(int i : row)
+            r += i == w.ints.front();
+    return r;);
+RANGES_PERF_CASE(view_join_copy,
+    thread_local std::vector<int> out;
+    out.resize(w.ints.size());
+    ranges::copy(w.rows | views::join, out.begin());
+    return out.back(););
+RANGES_PERF_CASE(loop_join_copy,
+    thread_local std::vector<int> out;
+    out.resize(w.ints.size());
+    auto it = out.begin();
+    for(auto const & row : w.rows)
+        for(int i : row)
+            *it++ = i;
+    return out.back(););
+
+// Arrays join into a sized, contiguous range that ranges::to copies at once.
+RANGES_PERF_CASE(view_join_arrays,
+    auto v = w.quads | views::join | ranges::to<std::vector>();
+    return static_cast<long long>(v.size()) + v.back(););
+RANGES_PERF_CASE(loop_join_arrays,
+    std::vector<int> v;
+    for(auto const & quad : w.quads)
+        for(int i : quad)
+            v.push_back(i);
+    return static_cast<long long>(v.size()) + v.back(););
+
+RANGES_PERF_CASE(view_linear_distribute,
+    return perf::sum(views::linear_distribute(
+                         0.0, 1.0, static_cast<std::ptrdiff_t>(w.ints.size())),
+                     [](double d) { return d; }););
+RANGES_PERF_CASE(loop_linear_distribute,
+    double r = 0;
+    auto const n = static_cast<std::ptrdiff_t>(w.ints.size());
+    double const delta = 1.0 / static_cast<double>(n - 1);
+    for(std::ptrdiff_t i = 0; i < n; ++i)
+        r += i == n - 1 ? 1.0 : static_cast<double>(i) * delta;
+    return r;);
+
+RANGES_PERF_CASE(view_lines,
+    return perf::sum(w.lines | views::lines, [](subrange<char const *> line) {
+        return static_cast<long long>(line.size());
+    }););
+RANGES_PERF_CASE(loop_lines,
+    long long r = 0;
+    char const * first = w.lines.data();
+    char const * const last = first + w.lines.size();
+    while(first != last)
+    {
+        auto nl = static_cast<char const *>(
+            std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+        if(!nl)
+            nl = last;
+        r += nl - first;
+        first = nl == last ? last : nl + 1;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_map,
+    return perf::sum(w.pairs | views::keys) - perf::sum(w.pairs | views::values););
+RANGES_PERF_CASE(loop_map,
+    long long r = 0;
+    for(auto const & p : w.pairs)
+        r += p.first - p.second;
+    return r;);
+
+RANGES_PERF_CASE(view_move,
+    return perf::sum(w.ints | views::move););
+RANGES_PERF_CASE(loop_move,
+    long long r = 0;
+    for(int const & i : w.ints)
+        r += std::move(i);
+    return r;);
+
+// Enough work per element for a parallel pipeline to pay for its buffering.
+RANGES_PERF_CASE(view_par,
+    auto const mix = [](int i) {
+        unsigned h = static_cast<unsigned>(i);
+        for(int k = 0; k < 64; ++k)
+            h = h * 2654435761u ^ (h >> 13);
+        return static_cast<int>(h & 0xffff);
+    };
+    return ranges::accumulate(w.ints | views::par(1024) | views::transform(mix) |
+                                  views::filter(even),
+                              0LL););
+RANGES_PERF_CASE(loop_par,
+    auto const mix = [](int i) {
+        unsigned h = static_cast<unsigned>(i);
+        for(int k = 0; k < 64; ++k)
+            h = h * 2654435761u ^ (h >> 13);
+        return static_cast<int>(h & 0xffff);
+    };
+    long long r = 0;
+    for(int i : w.ints)
+    {
+        int const m = mix(i);
+        if(even(m))
+            r += m;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_partial_sum,
+    return perf::sum(w.ints | views::partial_sum););
+RANGES_PERF_CASE(loop_partial_sum,
+    long long r = 0;
+    int acc = 0;
+    for(int i : w.ints)
+        r += (acc += i);
+    return r;);
+
+RANGES_PERF_CASE(view_ref,
+    return perf::sum(views::ref(w.ints)););
+RANGES_PERF_CASE(loop_ref,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_remove,
+    return perf::sum(w.ints | views::remove(0)););
+RANGES_PERF_CASE(loop_remove,
+    long long r = 0;
+    for(int i : w.ints)
+        if(i != 0)
+            r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_remove_if,
+    return perf::sum(w.ints | views::remove_if(even)););
+RANGES_PERF_CASE(loop_remove_if,
+    long long r = 0;
+    for(int i : w.ints)
+        if(!even(i))
+            r += i;
+    return r;);
+
+// ranges::to reserves the size hint of the filter once.
+RANGES_PERF_CASE(view_remove_if_to,
+    auto v = w.ints | views::remove_if(even) | ranges::to<std::vector>();
+    return static_cast<long long>(v.size()););
+RANGES_PERF_CASE(loop_remove_if_to,
+    std::vector<int> v;
+    for(int i : w.ints)
+        if(!even(i))
+            v.push_back(i);
+    return static_cast<long long>(v.size()););
+
+RANGES_PERF_CASE(view_repeat,
+    return perf::sum(views::repeat(7) |
+                     views::take(static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_repeat,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += 7;
+    return r;);
+
+RANGES_PERF_CASE(view_repeat_n,
+    return perf::sum(views::repeat_n(7, static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_repeat_n,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += 7;
+    return r;);
+
+RANGES_PERF_CASE(view_replace,
+    return perf::sum(w.ints | views::replace(0, 1000)););
+RANGES_PERF_CASE(loop_replace,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i == 0 ? 1000 : i;
+    return r;);
+
+RANGES_PERF_CASE(view_replace_if,
+    return perf::sum(w.ints | views::replace_if(even, 0)););
+RANGES_PERF_CASE(loop_replace_if,
+    long long r = 0;
+    for(int i : w.ints)
+        r += even(i) ? 0 : i;
+    return r;);
+
+RANGES_PERF_CASE(view_reverse,
+    return perf::sum(w.ints | views::reverse););
+RANGES_PERF_CASE(loop_reverse,
+    long long r = 0;
+    for(auto it = w.ints.rbegin(); it != w.ints.rend(); ++it)
+        r += *it;
+    return r;);
+
+RANGES_PERF_CASE(view_sample,
+    std::mt19937 gen{42};
+    return perf::sum(w.ints |
+                     views::sample(static_cast<std::ptrdiff_t>(w.ints.size() / 2), gen)););
+RANGES_PERF_CASE(loop_sample,
+    // Selection sampling, as views::sample does.
+    std::mt19937 gen{42};
+    long long r = 0;
+    auto n = static_cast<std::ptrdiff_t>(w.ints.size() / 2);
+    auto left = static_cast<std::ptrdiff_t>(w.ints.size());
+    for(std::size_t i = 0; n != 0; ++i, --left)
+    {
+        std::uniform_int_distribution<std::ptrdiff_t> dist{0, left - 1};
+        if(dist(gen) < n)
+        {
+            r += w.ints[i];
+            --n;
+        }
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_sample_input,
+    // A reservoir of 64 from a single-pass range of unknown size.
+    std::mt19937 gen{42};
+    int const * p = w.ints.data();
+    int const * const end = p + w.ints.size();
+    auto rng = views::generate([&] { return p++; }) |
+               views::take_while([end](int const * q) { return q != end; }) |
+               views::indirect;
+    return perf::sum(rng | views::sample(64, gen)););
+RANGES_PERF_CASE(loop_sample_input,
+    // Algorithm R, drawing a random index for each element.
+    std::mt19937 gen{42};
+    std::vector<int> reservoir;
+    std::ptrdiff_t n = 0;
+    for(int i : w.ints)
+    {
+        if(n < 64)
+            reservoir.push_back(i);
+        else
+        {
+            std::uniform_int_distribution<std::ptrdiff_t> dist{0, n};
+            auto const j = dist(gen);
+            if(j < 64)
+                reservoir[static_cast<std::size_t>(j)] = i;
+        }
+        ++n;
+    }
+    long long r = 0;
+    for(int i : reservoir)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_set_intersection,
+    return perf::sum(views::set_intersection(w.sorted, w.sorted2)););
+RANGES_PERF_CASE(loop_set_intersection,
+    long long r = 0;
+    auto i = w.sorted.begin(), j = w.sorted2.begin();
+    while(i != w.sorted.end() && j != w.sorted2.end())
+    {
+        if(*i < *j)
+            ++i;
+        else if(*j < *i)
+            ++j;
+        else
+        {
+            r += *i;
+            ++i;
+            ++j;
+        }
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_set_union,
+    return perf::sum(views::set_union(w.sorted, w.sorted2)););
+RANGES_PERF_CASE(loop_set_union,
+    long long r = 0;
+    auto i = w.sorted.begin(), j = w.sorted2.begin();
+    while(i != w.sorted.end() && j != w.sorted2.end())
+    {
+        if(*i < *j)
+            r += *i++;
+        else if(*j < *i)
+            r += *j++;
+        else
+        {
+            r += *i++;
+            ++j;
+        }
+    }
+    for(; i != w.sorted.end(); ++i)
+        r += *i;
+    for(; j != w.sorted2.end(); ++j)
+        r += *j;
+    return r;);
+
+RANGES_PERF_CASE(view_single,
+    return perf::sum(w.ints | views::transform([](int i) { return views::single(i); }) |
+                     views::join););
+RANGES_PERF_CASE(loop_single,
+    long long r = 0;
+    for(int i : w.ints)
+        r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_slice,
+    auto const n = static_cast<std::ptrdiff_t>(w.ints.size());
+    return perf::sum(w.ints | views::slice(n / 4, 3 * n / 4)););
+RANGES_PERF_CASE(loop_slice,
+    long long r = 0;
+    for(std::size_t i = w.ints.size() / 4; i < 3 * w.ints.size() / 4; ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_sliding,
+    return sum_sizes(w.ints | views::sliding(4)););
+RANGES_PERF_CASE(loop_sliding,
+    long long r = 0;
+    for(std::size_t i = 0; i + 4 <= w.ints.size(); ++i)
+        for(std::size_t j = i; j < i + 4; ++j)
+            r += w.ints[j];
+    return r;);
+
+RANGES_PERF_CASE(view_span,
+    return perf::sum(span<int const>(w.ints.data(),
+                                     static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_span,
+    long long r = 0;
+    for(int const * p = w.ints.data(), *e = p + w.ints.size(); p != e; ++p)
+        r += *p;
+    return r;);
+
+RANGES_PERF_CASE(view_split,
+    return sum_sizes(w.ints | views::split(0)););
+RANGES_PERF_CASE(loop_split,
+    long long r = 0;
+    for(int i : w.ints)
+        if(i != 0)
+            r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_split_when,
+    return sum_sizes(w.ints | views::split_when([](int i) { return i == 0; })););
+RANGES_PERF_CASE(loop_split_when,
+    long long r = 0;
+    for(int i : w.ints)
+        if(i != 0)
+            r += i;
+    return r;);
+
+RANGES_PERF_CASE(view_stride,
+    return perf::sum(w.ints | views::stride(4)););
+RANGES_PERF_CASE(loop_stride,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); i += 4)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_subrange,
+    return perf::sum(make_subrange(w.ints.begin(), w.ints.end())););
+RANGES_PERF_CASE(loop_subrange,
+    long long r = 0;
+    for(auto it = w.ints.begin(); it != w.ints.end(); ++it)
+        r += *it;
+    return r;);
+
+RANGES_PERF_CASE(view_tail,
+    return perf::sum(w.ints | views::tail););
+RANGES_PERF_CASE(loop_tail,
+    long long r = 0;
+    for(std::size_t i = 1; i < w.ints.size(); ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_take,
+    return perf::sum(w.ints | views::take(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_take,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size() / 2; ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_take_exactly,
+    return perf::sum(w.ints |
+                     views::take_exactly(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_take_exactly,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size() / 2; ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_take_last,
+    return perf::sum(w.ints |
+                     views::take_last(static_cast<std::ptrdiff_t>(w.ints.size() / 2))););
+RANGES_PERF_CASE(loop_take_last,
+    long long r = 0;
+    for(std::size_t i = w.ints.size() - w.ints.size() / 2; i < w.ints.size(); ++i)
+        r += w.ints[i];
+    return r;);
+
+RANGES_PERF_CASE(view_take_while,
+    return perf::sum(w.sorted | views::take_while(small)););
+RANGES_PERF_CASE(loop_take_while,
+    long long r = 0;
+    for(int i : w.sorted)
+    {
+        if(!small(i))
+            break;
+        r += i;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_tokenize,
+    static std::regex const number{"[0-9]+"};
+    return perf::sum(w.digits | views::tokenize(number), [](auto const & m) {
+        return static_cast<long long>(m.length());
+    }););
+RANGES_PERF_CASE(loop_tokenize,
+    static std::regex const number{"[0-9]+"};
+    long long r = 0;
+    for(std::sregex_token_iterator it{w.digits.begin(), w.digits.end(), number}, e;
+        it != e;
+        ++it)
+        r += static_cast<long long>(it->length());
+    return r;);
+
+RANGES_PERF_CASE(view_tokenize_delimiters,
+    return perf::sum(w.digits | views::tokenize(delimiter_set{" "}),
+                     [](auto const & t) { return static_cast<long long>(t.size()); }););
+RANGES_PERF_CASE(loop_tokenize_delimiters,
+    long long r = 0;
+    auto first = w.digits.begin(), last = w.digits.end();
+    while(first != last)
+    {
+        first = std::find_if(first, last, [](char c) { return c != ' '; });
+        auto const token = first;
+        first = std::find(first, last, ' ');
+        r += first - token;
+    }
+    return r;);
+
+RANGES_PERF_CASE(view_transform,
+    return perf::sum(w.ints | views::transform(twice)););
+RANGES_PERF_CASE(loop_transform,
+    long long r = 0;
+    for(int i : w.ints)
+        r += twice(i);
+    return r;);
+
+RANGES_PERF_CASE(view_trim,
+    return perf::sum(w.sorted | views::trim(small)););
+RANGES_PERF_CASE(loop_trim,
+    long long r = 0;
+    auto first = w.sorted.begin(), last = w.sorted.end();
+    while(first != last && small(*first))
+        ++first;
+    while(first != last && small(*(last - 1)))
+        --last;
+    for(; first != last; ++first)
+        r += *first;
+    return r;);
+
+RANGES_PERF_CASE(view_unbounded,
+    return perf::sum(views::unbounded(w.ints.data()) |
+                     views::take(static_cast<std::ptrdiff_t>(w.ints.size()))););
+RANGES_PERF_CASE(loop_unbounded,
+    long long r = 0;
+    int const * p = w.ints.data();
+    for(std::size_t n = w.ints.size(); n != 0; --n)
+        r += *p++;
+    return r;);
+
+RANGES_PERF_CASE(view_unique,
+    return perf::sum(w.sorted | views::unique););
+RANGES_PERF_CASE(loop_unique,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.sorted.size(); ++i)
+        if(i == 0 || w.sorted[i] != w.sorted[i - 1])
+            r += w.sorted[i];
+    return r;);
+
+RANGES_PERF_CASE(view_zip,
+    return perf::sum(views::zip(w.ints, w.sorted), [](auto t) {
+        return static_cast<long long>(std::get<0>(t) * std::get<1>(t));
+    }););
+RANGES_PERF_CASE(loop_zip,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += w.ints[i] * w.sorted[i];
+    return r;);
+
+RANGES_PERF_CASE(view_zip_with,
+    return perf::sum(views::zip_with(std::multiplies<>{}, w.ints, w.sorted)););
+RANGES_PERF_CASE(loop_zip_with,
+    long long r = 0;
+    for(std::size_t i = 0; i < w.ints.size(); ++i)
+        r += w.ints[i] * w.sorted[i];
+    return r;);
@@ -14,6 +14,8 @@
 #include <cstring>
 #include <utility>
 #include <algorithm>
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/equal.hpp>
@@ -91,5 +93,31 @@ int main()
         CHECK(sout.str() == "1 1 1 1 1 ");
     }
 
+    // Contiguous ranges of trivially copyable type are copied with memmove.
+    {
+        using ranges::detail::is_memmovable;
+        using VI = std::vector<int>::iterator;
+        using VCI = std::vector<int>::const_iterator;
+        CPP_assert(is_memmovable<int const *, int const *, int *>::value);
+        CPP_assert(is_memmovable<VCI, VCI, VI>::value);
+        CPP_assert(!is_memmovable<int *, int *, long *>::value);
+        CPP_assert(!is_memmovable<int volatile *, int volatile *, int *>::value);
+        CPP_assert(!is_memmovable<RandomAccessIterator<int *>,
+                                  RandomAccessIterator<int *>, int *>::value);
+        CPP_assert(!is_memmovable<std::string *, std::string *, std::string *>::value);
+
+        std::vector<int> src(1000), dst(1000);
+        for(int i = 0; i < 1000; ++i)
+            src[(std::size_t)i] = i;
+        auto res2 = ranges::copy(src, dst.begin());
+        CHECK(res2.in == src.end());
+        CHECK(res2.out == dst.end());
+        CHECK(src == dst);
+
+        auto res3 = ranges::copy(src.cbegin(), src.cbegin(), dst.begin());
+        CHECK(res3.in == src.cbegin());
+        CHECK(res3.out == dst.begin());
+    }
+
     return test_result();
 }
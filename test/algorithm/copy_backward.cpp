@@ -70,5 +70,19 @@ int main()
         CHECK(std::equal(a, a + size(a), out));
     }
 
+    // Overlapping, contiguous ranges of trivially copyable type
+    {
+        int ia[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto res = ranges::copy_backward(ia, ia + 7, ia + 10);
+        CHECK(res.in == ia + 7);
+        CHECK(res.out == ia + 3);
+        int const expected[] = {0, 1, 2, 0, 1, 2, 3, 4, 5, 6};
+        CHECK(std::equal(ia, ia + 10, expected));
+
+        auto res2 = ranges::copy_backward(ia, ia, ia + 10);
+        CHECK(res2.in == ia);
+        CHECK(res2.out == ia + 10);
+    }
+
     return test_result();
 }
@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include "../simple_test.hpp"
@@ -19,6 +20,25 @@ struct S
     int i;
 };
 
+// Contiguous ranges of integers are counted with vector instructions, in runs
+// that must not overflow narrow lanes.
+template<typename T>
+void test_contiguous()
+{
+    std::vector<T> v;
+    std::ptrdiff_t threes = 0;
+    for(int i = 0; i < 10000; ++i)
+    {
+        v.push_back(T(i % 3 == 0 ? 3 : i % 5));
+        threes += i % 3 == 0 || i % 5 == 3;
+        if(i < 100 || i % 997 == 0)
+            CHECK(ranges::count(v, T(3)) == threes);
+    }
+    CHECK(ranges::count(v, T(9)) == 0);
+    CHECK(ranges::count(v, 1LL << 40) == 0);
+    CHECK(ranges::count(std::vector<T>(300, T(1)), T(1)) == 300);
+}
+
 int main()
 {
     using namespace ranges;
@@ -57,5 +77,11 @@ int main()
     CHECK(count(make_subrange(InputIterator<const S*>(sa),
                       Sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    test_contiguous<char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+
     return ::test_result();
 }
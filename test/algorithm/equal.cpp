@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -271,6 +272,25 @@ void test_rng_pred()
                   std::equal_to<int>()));
 }
 
+// Contiguous ranges of integers are compared with memcmp.
+template<typename T>
+void test_contiguous()
+{
+    for(std::size_t n = 0; n <= 40; ++n)
+    {
+        std::vector<T> a(n, T(5)), b(n, T(5));
+        CHECK(ranges::equal(a, b));
+        CHECK(!ranges::equal(a, std::vector<T>(n + 1, T(5))));
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            b[i] = T(6);
+            CHECK(!ranges::equal(a, b));
+            CHECK(!ranges::equal(a.begin(), a.end(), b.begin(), b.end()));
+            b[i] = T(5);
+        }
+    }
+}
+
 int main()
 {
     ::test();
@@ -291,5 +311,10 @@ int main()
     static_assert(ranges::equal(IL{}, IL{}), "");
 #endif
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+
     return ::test_result();
 }
@@ -0,0 +1,63 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/equal_range_many.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    std::vector<int> hay;
+    for(int i = 0; i < 1000; ++i)
+        hay.push_back(i / 3 * 2);
+    using It = std::vector<int>::iterator;
+
+    {
+        std::vector<int> needles = {-3, 0, 0, 1, 2, 3, 100, 101, 664, 665, 666, 1000};
+        std::vector<ranges::subrange<It>> out;
+        auto res = ranges::equal_range_many(hay, needles, ranges::back_inserter(out));
+        CHECK(res.in == needles.end());
+        CHECK(out.size() == needles.size());
+        for(std::size_t i = 0; i < needles.size(); ++i)
+        {
+            auto p = std::equal_range(hay.begin(), hay.end(), needles[i]);
+            CHECK(out[i].begin() == p.first);
+            CHECK(out[i].end() == p.second);
+        }
+    }
+
+    {
+        std::vector<int> needles = {0, -4, -5, -200};
+        std::vector<ranges::subrange<ForwardIterator<It>>> out;
+        ranges::equal_range_many(ForwardIterator<It>(hay.begin()),
+                                 ForwardIterator<It>(hay.end()),
+                                 needles.begin(), needles.end(),
+                                 ranges::back_inserter(out),
+                                 std::greater<int>{}, std::negate<int>{});
+        CHECK(out.size() == 4u);
+        CHECK(out[0].begin().base() == hay.begin());
+        CHECK(ranges::distance(out[0]) == 3);
+        CHECK(out[1].begin().base() == hay.begin() + 6);
+        CHECK(ranges::distance(out[1]) == 3);
+        CHECK(out[2].empty());
+        CHECK(out[2].begin().base() == hay.begin() + 9);
+        CHECK(out[3].begin().base() == hay.begin() + 300);
+        CHECK(ranges::distance(out[3]) == 3);
+    }
+
+    return ::test_result();
+}
@@ -96,5 +96,24 @@ int main()
     test_int<BidirectionalIterator<int*>, Sentinel<int*> >();
     test_int<RandomAccessIterator<int*>, Sentinel<int*> >();
 
+    // Byte-sized elements are filled with memset.
+    {
+        using ranges::detail::is_memsettable;
+        CPP_assert(is_memsettable<char *, char *, char>::value);
+        CPP_assert(is_memsettable<std::vector<unsigned char>::iterator,
+                                  std::vector<unsigned char>::iterator, int>::value);
+        CPP_assert(!is_memsettable<int *, int *, int>::value);
+        CPP_assert(!is_memsettable<RandomAccessIterator<char *>,
+                                   RandomAccessIterator<char *>, char>::value);
+
+        std::vector<unsigned char> v(100, 0);
+        CHECK(ranges::fill(v, 300) == v.end());
+        CHECK(std::count(v.begin(), v.end(), (unsigned char)44) == 100);
+
+        bool b[10] = {};
+        CHECK(ranges::fill(b, 2) == b + 10);
+        CHECK(std::count(b, b + 10, true) == 10);
+    }
+
     return ::test_result();
 }
@@ -30,6 +30,28 @@ struct S
     int i_;
 };
 
+// Contiguous ranges of integers are searched with vector instructions; check
+// every length and position around the vector widths.
+template<typename T>
+void test_contiguous()
+{
+    for(int n = 0; n <= 80; ++n)
+    {
+        std::vector<T> v(static_cast<std::size_t>(n), T(7));
+        CHECK(ranges::find(v, T(3)) == v.end());
+        for(int i = n - 1; i >= 0; --i)
+        {
+            v[static_cast<std::size_t>(i)] = T(3);
+            CHECK((ranges::find(v, T(3)) - v.begin()) == i);
+            CHECK((ranges::find(v.data(), v.data() + n, T(3)) - v.data()) == i);
+        }
+    }
+    // Values that no T can equal are never found.
+    std::vector<T> v{T(0), T(-1), T(1)};
+    CHECK(ranges::find(v, 1LL << 40) == v.end());
+    CHECK((ranges::find(v, -1LL) - v.begin()) == (std::is_signed<T>::value ? 1 : 3));
+}
+
 int main()
 {
     using namespace ranges;
@@ -87,5 +109,12 @@ int main()
         CHECK(it == vec.begin() + 1);
     }
 
+    test_contiguous<char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+
     return ::test_result();
 }
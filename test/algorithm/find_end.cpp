@@ -18,7 +18,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_end.hpp>
 #include "../simple_test.hpp"
@@ -292,5 +294,20 @@ int main()
     // test_proj<RandomAccessIterator<const S*>, BidirectionalIterator<const int*>, Sentinel<const S*>, Sentinel<const int *> >();
     // test_proj<RandomAccessIterator<const S*>, RandomAccessIterator<const int*>, Sentinel<const S*>, Sentinel<const int *> >();
 
+    // Long patterns are searched for from the back with a searcher
+    {
+        std::vector<int> ia(100);
+        for(std::size_t i = 0; i < ia.size(); ++i)
+            ia[i] = int(i % 30) + (i % 7 == 0 ? 256 : 0);
+        std::vector<int> const ib(ia.begin() + 40, ia.begin() + 52);
+        auto const res = ranges::find_end(ia, ib);
+        auto const expected = std::find_end(ia.begin(), ia.end(), ib.begin(), ib.end());
+        CHECK(res.begin() == expected);
+        CHECK(res.end() == expected + 12);
+        std::vector<int> const ic(ib.rbegin(), ib.rend());
+        CHECK(ranges::find_end(ia, ic).begin() == ia.end());
+        CHECK(ranges::find_end(ia, ic).end() == ia.end());
+    }
+
     return ::test_result();
 }
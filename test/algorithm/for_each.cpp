@@ -9,9 +9,12 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <atomic>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -47,5 +50,28 @@ int main()
     CHECK(::is_dangling(ranges::for_each(::MakeTestRange(v1.begin(), v1.end()), fun).in));
     CHECK(sum == 12);
 
+    // Check execution policies
+    {
+        std::vector<int> v(100000, 1);
+        std::atomic<long> total{0};
+        auto afun = [&](int i) { total += i; };
+        CHECK(ranges::for_each(ranges::execution::par, v, afun) == v.end());
+        CHECK(total == 100000);
+        CHECK(ranges::for_each(ranges::execution::par_unseq, v.begin(), v.end(),
+                               [](int & i) { i *= 3; }) == v.end());
+        CHECK(ranges::for_each(ranges::execution::seq, v, afun) == v.end());
+        CHECK(total == 400000);
+
+        total = 0;
+        auto rng = ranges::views::iota(0, 100000) |
+                   ranges::views::transform([](int i) { return i % 10; });
+        CHECK(ranges::for_each(ranges::execution::par, rng, afun) == ranges::end(rng));
+        CHECK(total == 450000);
+
+        sum = 0;
+        CHECK(ranges::for_each(ranges::execution::par, v2, &S::p) == v2.end());
+        CHECK(sum == 12);
+    }
+
     return ::test_result();
 }
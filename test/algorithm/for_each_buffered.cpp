@@ -0,0 +1,78 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/for_each_buffered.hpp>
+#include <range/v3/view/any_view.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // Ranges that cannot be read in blocks are visited as by for_each.
+    {
+        std::vector<int> v = {1, 2, 3, 4};
+        int sum = 0;
+        auto res = for_each_buffered(v, [&sum](int i) { sum += i; });
+        CHECK(res.in == v.end());
+        CHECK(sum == 10);
+        CHECK(::is_dangling(
+            for_each_buffered(std::vector<int>{1}, [](int) {}).in));
+        int calls = 0;
+        for_each_buffered(v, [](int & i) { ++i; }, [&calls](int & i) -> int & {
+            ++calls;
+            return i;
+        });
+        CHECK(calls == 4);
+        ::check_equal(v, {2, 3, 4, 5});
+    }
+
+    // An any_view is read in blocks of up to 64 elements.
+    {
+        int reads = 0;
+        any_view<int, category::forward> counted =
+            views::iota(0, 100) | views::transform([&reads](int i) {
+                ++reads;
+                return i;
+            });
+        int sum = 0;
+        for_each_buffered(counted, [&](int i) {
+            CHECK(reads == (i < 64 ? 64 : 100));
+            sum += i;
+        });
+        CHECK(sum == 4950);
+
+        std::list<int> l = {1, 2, 3};
+        any_view<int &, category::forward> by_address = l;
+        auto res = for_each_buffered(by_address, [](int & i) { i *= 2; });
+        CHECK(res.in == by_address.end());
+        ::check_equal(l, {2, 4, 6});
+
+        any_view<std::string, category::forward> strings =
+            views::iota(0, 100) |
+            views::transform([](int i) { return std::to_string(i); });
+        std::string all;
+        for_each_buffered(strings, [&all](std::string s) { all += s; });
+        CHECK(all.size() == 190u);
+
+        any_view<int &, category::forward> empty;
+        CHECK(for_each_buffered(empty, [](int &) { CHECK(false); }).in == empty.end());
+    }
+
+    return test_result();
+}
@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
 #include "../simple_test.hpp"
@@ -167,10 +168,39 @@ void test_iter_comp()
 }
 
 
+// Contiguous ranges of integers are compared with vector instructions up to
+// the first difference, which must then be compared as T, not as bytes.
+template<typename T>
+void test_contiguous()
+{
+    for(std::size_t n = 0; n <= 40; ++n)
+    {
+        std::vector<T> a(n, T(1)), b(n, T(1));
+        CHECK(!ranges::lexicographical_compare(a, b));
+        b.push_back(T(0));
+        CHECK(ranges::lexicographical_compare(a, b));
+        CHECK(!ranges::lexicographical_compare(b, a));
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            a[i] = T(-1);
+            b[i] = T(0x100);
+            CHECK(ranges::lexicographical_compare(a, b) == (T(-1) < T(0x100)));
+            CHECK(ranges::lexicographical_compare(b, a) == (T(0x100) < T(-1)));
+            a[i] = b[i] = T(1);
+        }
+    }
+}
+
 int main()
 {
     test_iter();
     test_iter_comp();
 
+    test_contiguous<char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+
     return test_result();
 }
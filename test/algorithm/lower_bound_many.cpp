@@ -0,0 +1,94 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/lower_bound_many.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    std::vector<int> hay;
+    for(int i = 0; i < 1000; ++i)
+        hay.push_back(i / 3 * 2);
+    using It = std::vector<int>::iterator;
+    auto expected = [&](std::vector<int> const & needles) {
+        std::vector<It> its;
+        for(int n : needles)
+            its.push_back(std::lower_bound(hay.begin(), hay.end(), n));
+        return its;
+    };
+
+    // Sorted needles, dense and sparse, some absent and out of range.
+    {
+        std::vector<int> needles = {-3, 0, 0, 1, 2, 3, 4, 5, 100, 101, 401, 664, 665, 666, 1000};
+        std::vector<It> out;
+        auto res = ranges::lower_bound_many(hay, needles, ranges::back_inserter(out));
+        CHECK(res.in == needles.end());
+        CHECK(out == expected(needles));
+
+        std::vector<ForwardIterator<It>> fout;
+        ranges::lower_bound_many(ForwardIterator<It>(hay.begin()),
+                                 ForwardIterator<It>(hay.end()),
+                                 InputIterator<int const *>(needles.data()),
+                                 InputIterator<int const *>(needles.data() + needles.size()),
+                                 ranges::back_inserter(fout));
+        CHECK(fout.size() == needles.size());
+        for(std::size_t i = 0; i < fout.size(); ++i)
+            CHECK(fout[i].base() == expected(needles)[i]);
+    }
+
+    // Needles in any order, in more than one batch.
+    {
+        std::vector<int> needles;
+        for(int i = 0; i < 100; ++i)
+            needles.push_back((i * 37) % 701 - 10);
+        std::vector<It> out;
+        auto res = ranges::lower_bound_batch(hay, needles, ranges::back_inserter(out));
+        CHECK(res.in == needles.end());
+        CHECK(out == expected(needles));
+
+        std::vector<int> empty;
+        out.clear();
+        ranges::lower_bound_batch(empty, needles, ranges::back_inserter(out));
+        CHECK(out.size() == needles.size());
+        CHECK(ranges::lower_bound_batch(hay, empty, out.begin()).out == out.begin());
+    }
+
+    // With a comparison and a projection.
+    {
+        using P = std::pair<int, int>;
+        std::vector<P> pairs;
+        for(int i = 0; i < 50; ++i)
+            pairs.emplace_back(i, 100 - 2 * i);
+        std::vector<int> needles = {100, 99, 50, 3, -1};
+        std::vector<std::vector<P>::iterator> out, out2;
+        ranges::lower_bound_many(pairs, needles, ranges::back_inserter(out),
+                                 std::greater<int>{}, &P::second);
+        ranges::lower_bound_batch(pairs, needles, ranges::back_inserter(out2),
+                                  std::greater<int>{}, &P::second);
+        CHECK(out == out2);
+        CHECK(out.size() == 5u);
+        CHECK(out[0]->first == 0);
+        CHECK(out[1]->first == 1);
+        CHECK(out[2]->first == 25);
+        CHECK(out[3]->first == 49);
+        CHECK(out[4] == pairs.end());
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,86 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/view/iota.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    // Many runs of different lengths, some of them empty.
+    {
+        std::vector<std::vector<int>> runs(64);
+        std::vector<int> expected;
+        for(int i = 0; i < 64; ++i)
+            for(int j = 0; j < (i * 7) % 23; ++j)
+            {
+                runs[i].push_back((i * 31 + j * 17) % 101 + j * 100);
+                expected.push_back(runs[i].back());
+            }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> out(expected.size());
+        auto res = ranges::merge_k(runs, out.begin());
+        CHECK(res.in == runs.end());
+        CHECK(res.out == out.end());
+        CHECK(out == expected);
+
+        std::vector<int> rout;
+        ranges::merge_k(std::move(runs), ranges::back_inserter(rout));
+        CHECK(rout == expected);
+    }
+
+    // No runs, one run, and runs that are all empty.
+    {
+        std::vector<std::vector<int>> runs;
+        int out[4] = {0};
+        CHECK(ranges::merge_k(runs, out).out == out);
+        runs.push_back({});
+        runs.push_back({});
+        CHECK(ranges::merge_k(runs, out).out == out);
+        runs.push_back({1, 2, 3});
+        CHECK(ranges::merge_k(runs, out).out == out + 3);
+        ::check_equal(ranges::make_subrange(out, out + 3), {1, 2, 3});
+    }
+
+    // Equal elements come out in the order of their runs.
+    {
+        using P = std::pair<int, int>;
+        std::vector<std::vector<P>> runs = {
+            {{1, 0}, {3, 0}, {3, 1}}, {{1, 1}, {2, 0}, {3, 2}}, {{0, 0}, {3, 3}}};
+        std::vector<P> out;
+        ranges::merge_k(runs, ranges::back_inserter(out), std::less<int>{}, &P::first);
+        ::check_equal(out,
+                      {P{0, 0}, P{1, 0}, P{1, 1}, P{2, 0}, P{3, 0}, P{3, 1}, P{3, 2},
+                       P{3, 3}});
+    }
+
+    // Descending runs, held by value as views.
+    {
+        std::vector<decltype(ranges::views::iota(0, 0))> runs = {
+            ranges::views::iota(0, 10), ranges::views::iota(5, 8),
+            ranges::views::iota(9, 12)};
+        std::vector<int> out;
+        ranges::merge_k(runs, ranges::back_inserter(out), std::greater<int>{},
+                        [](int i) { return -i; });
+        ::check_equal(out, {0, 1, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 9, 9, 10, 11});
+    }
+
+    return ::test_result();
+}
@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
@@ -99,6 +100,28 @@ struct S
     int i;
 };
 
+// Contiguous ranges of integers are compared with vector instructions; check
+// every position around the vector widths.
+template<typename T>
+void test_contiguous()
+{
+    for(std::size_t n = 0; n <= 80; ++n)
+    {
+        std::vector<T> a(n, T(5)), b(n + 3, T(5));
+        auto r = ranges::mismatch(a, b);
+        CHECK(r.in1 == a.end());
+        CHECK(r.in2 == b.begin() + static_cast<std::ptrdiff_t>(n));
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            b[i] = T(0x106);
+            r = ranges::mismatch(a, b);
+            CHECK(r.in1 == a.begin() + static_cast<std::ptrdiff_t>(i));
+            CHECK(r.in2 == b.begin() + static_cast<std::ptrdiff_t>(i));
+            b[i] = T(5);
+        }
+    }
+}
+
 int main()
 {
     test_iter<InputIterator<const int*>>();
@@ -135,5 +158,10 @@ int main()
     CHECK(ps2.in1->i == -4);
     CHECK(ps2.in2->i == 5);
 
+    test_contiguous<char>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+
     return test_result();
 }
@@ -237,5 +237,15 @@ int main()
     test1<RandomAccessIterator<std::unique_ptr<int>*>, BidirectionalIterator<std::unique_ptr<int>*>, Sentinel<std::unique_ptr<int>*> >();
     test1<RandomAccessIterator<std::unique_ptr<int>*>, RandomAccessIterator<std::unique_ptr<int>*>, Sentinel<std::unique_ptr<int>*> >();
 
+    // Overlapping, contiguous ranges of trivially copyable type
+    {
+        int ia[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto res = ranges::move(ia + 3, ia + 10, ia);
+        CHECK(res.in == ia + 10);
+        CHECK(res.out == ia + 7);
+        int const expected[] = {3, 4, 5, 6, 7, 8, 9, 7, 8, 9};
+        CHECK(std::equal(ia, ia + 10, expected));
+    }
+
     return test_result();
 }
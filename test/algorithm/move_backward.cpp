@@ -144,5 +144,15 @@ int main()
     test1<std::unique_ptr<int>*, RandomAccessIterator<std::unique_ptr<int>*> >();
     test1<std::unique_ptr<int>*, std::unique_ptr<int>*>();
 
+    // Overlapping, contiguous ranges of trivially copyable type
+    {
+        int ia[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        auto res = ranges::move_backward(ia + 2, ia + 10, ia + 8);
+        CHECK(res.in == ia + 10);
+        CHECK(res.out == ia);
+        int const expected[] = {2, 3, 4, 5, 6, 7, 8, 9, 8, 9};
+        CHECK(std::equal(ia, ia + 10, expected));
+    }
+
     return test_result();
 }
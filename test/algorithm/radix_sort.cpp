@@ -0,0 +1,201 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Also check that sort and stable_sort dispatch to the radix sort.
+#define RANGES_SORT_USE_RADIX 1
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/view/all.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    std::mt19937 gen;
+
+    struct S
+    {
+        int i, j;
+    };
+
+    template<typename T, typename Dist>
+    void test_keys(std::size_t n, Dist dist)
+    {
+        std::vector<T> v(n);
+        for(auto & t : v)
+            t = static_cast<T>(dist(gen));
+        auto w = v;
+        std::sort(w.begin(), w.end());
+        CHECK(ranges::radix_sort(v) == v.end());
+        CHECK(v == w);
+        // Already sorted
+        CHECK(ranges::radix_sort(v.begin(), v.end()) == v.end());
+        CHECK(v == w);
+    }
+
+    template<typename T>
+    void test_int_keys(std::size_t n)
+    {
+        using L = std::numeric_limits<T>;
+        test_keys<T>(n, std::uniform_int_distribution<long long>(L::min(), L::max()));
+        // Keys that agree on all but the low byte
+        test_keys<T>(n, std::uniform_int_distribution<long long>(0, 100));
+    }
+}
+
+int main()
+{
+    // Empty and tiny ranges
+    {
+        int d = 0;
+        CHECK(ranges::radix_sort(&d, &d) == &d);
+        CHECK(ranges::radix_sort(&d, &d + 1) == &d + 1);
+        std::vector<int> v(2000, 42);
+        CHECK(ranges::radix_sort(v) == v.end());
+        CHECK(std::count(v.begin(), v.end(), 42) == 2000);
+    }
+
+    for(std::size_t n : {2u, 17u, 1000u, 5000u})
+    {
+        test_int_keys<int>(n);
+        test_int_keys<unsigned>(n);
+        test_int_keys<signed char>(n);
+        test_int_keys<std::int16_t>(n);
+        test_int_keys<std::int64_t>(n);
+        test_int_keys<std::uint64_t>(n);
+        test_keys<float>(n, std::uniform_real_distribution<float>(-1e6f, 1e6f));
+        test_keys<double>(n, std::normal_distribution<double>(0.0, 1e10));
+    }
+
+    // bool keys
+    {
+        std::vector<bool> v(100);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = i % 3 == 0;
+        std::vector<int> w(v.begin(), v.end());
+        std::vector<S> s(100);
+        for(std::size_t i = 0; i < s.size(); ++i)
+            s[i] = S{(int)i, (int)i};
+        ranges::radix_sort(s, [](S const & x) { return x.i % 3 != 0; });
+        for(std::size_t i = 0; i + 1 < s.size(); ++i)
+        {
+            CHECK((s[i].i % 3 != 0) <= (s[i + 1].i % 3 != 0));
+            if((s[i].i % 3 != 0) == (s[i + 1].i % 3 != 0))
+                CHECK(s[i].j < s[i + 1].j);
+        }
+    }
+
+    // -0.0 and +0.0 are equivalent, so their relative order is preserved.
+    {
+        std::vector<S> s(2000);
+        std::vector<double> keys(s.size());
+        for(std::size_t i = 0; i < s.size(); ++i)
+        {
+            keys[i] = i % 4 == 0 ? 0.0 : i % 4 == 1 ? -0.0 : i % 4 == 2 ? -1.5 : 1.5;
+            s[i] = S{(int)i, (int)i};
+        }
+        ranges::radix_sort(s, [&](S const & x) { return keys[(std::size_t)x.i]; });
+        for(std::size_t i = 0; i + 1 < s.size(); ++i)
+        {
+            double a = keys[(std::size_t)s[i].i], b = keys[(std::size_t)s[i + 1].i];
+            CHECK(!(b < a));
+            if(!(a < b))
+                CHECK(s[i].j < s[i + 1].j);
+        }
+    }
+
+    // Projections and stability
+    {
+        std::vector<S> v(5000);
+        std::uniform_int_distribution<int> dist(-50, 50);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = S{dist(gen), i};
+        auto w = v;
+        std::stable_sort(w.begin(), w.end(), [](S a, S b) { return a.i < b.i; });
+        auto same = [](S const & a, S const & b) { return a.i == b.i && a.j == b.j; };
+
+        auto v2 = v;
+        CHECK(ranges::radix_sort(v2, &S::i) == v2.end());
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        v2 = v;
+        CHECK(ranges::radix_sort(ranges::views::all(v2), &S::i) == v2.end());
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        v2 = v;
+        CHECK(::is_dangling(ranges::radix_sort(std::move(v2), &S::i)));
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        v2 = v;
+        std::vector<S> buf(v2.size());
+        CHECK(ranges::aux::radix_sort_n_with_buffer(
+                  v2.begin(), (std::ptrdiff_t)v2.size(), buf.data(), &S::i) ==
+              v2.end());
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        // Dispatch from stable_sort
+        CPP_assert(ranges::detail::use_radix_sort<std::vector<S>::iterator,
+                                                  std::less<int>,
+                                                  int S::*>::value);
+        v2 = v;
+        ranges::stable_sort(v2, std::less<int>{}, &S::i);
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        // Dispatch from sort; the radix sort happens to be stable.
+        v2 = v;
+        ranges::sort(v2, ranges::less{}, &S::i);
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+
+        // No dispatch for other orders
+        CPP_assert(!ranges::detail::use_radix_sort<std::vector<S>::iterator,
+                                                   std::greater<int>,
+                                                   int S::*>::value);
+        v2 = v;
+        ranges::sort(v2, std::greater<int>{}, &S::i);
+        CHECK(std::is_sorted(v2.begin(), v2.end(), [](S a, S b) { return a.i > b.i; }));
+    }
+
+    // Non-trivially copyable and move-only element types
+    {
+        std::vector<std::pair<int, std::string>> v(3000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = {(int)v.size() - i - 1, std::to_string(i)};
+        ranges::radix_sort(v, [](std::pair<int, std::string> const & p) { return p.first; });
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i].first == i);
+            CHECK(v[i].second == std::to_string((int)v.size() - i - 1));
+        }
+
+        std::vector<std::unique_ptr<int>> u(3000);
+        for(int i = 0; (std::size_t)i < u.size(); ++i)
+            u[i].reset(new int((int)u.size() - i - 1));
+        ranges::radix_sort(u, [](std::unique_ptr<int> const & p) { return *p; });
+        for(int i = 0; (std::size_t)i < u.size(); ++i)
+            CHECK(*u[i] == i);
+    }
+
+    return ::test_result();
+}
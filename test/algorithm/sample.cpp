@@ -277,5 +277,27 @@ int main()
         }
     }
 
+    // Reservoir sampling of an input range of unknown size: each element is
+    // chosen about as often.
+    {
+        std::array<int, N> i;
+        ranges::iota(i, 0);
+        std::array<int, N> counts{};
+        std::mt19937 g;
+        constexpr int trials = 4000, expected = trials * int(K) / int(N);
+        for(int t = 0; t < trials; ++t)
+        {
+            std::array<int, K> a;
+            auto result = ranges::sample(InputIterator<int*>(i.data()),
+                Sentinel<int*>(i.data() + N), a.begin(), int(K), g);
+            CHECK(result.in.base() == i.data() + N);
+            CHECK(result.out == a.end());
+            for(int x : a)
+                ++counts[static_cast<std::size_t>(x)];
+        }
+        for(int c : counts)
+            CHECK((c > expected * 3 / 4 && c < expected * 5 / 4));
+    }
+
     return ::test_result();
 }
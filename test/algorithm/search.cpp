@@ -22,6 +22,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/search.hpp>
@@ -176,6 +177,49 @@ struct T
     int i;
 };
 
+// Every searcher must agree with std::search, on every substring of a text
+// with many repetitions and on patterns that do not occur.
+template<class MakeSearcher>
+void
+test_searcher(MakeSearcher make)
+{
+    std::string const hay = "abaabaabbabaabaaabababaabbbaabaabaabaabababb";
+    for(std::size_t pos = 0; pos <= hay.size(); ++pos)
+    {
+        for(std::size_t len = 0; pos + len <= hay.size() && len <= 20; ++len)
+        {
+            std::string pat = hay.substr(pos, len);
+            for(int flip = 0; flip < 2; ++flip)
+            {
+                if(flip && !pat.empty())
+                    pat.back() = pat.back() == 'a' ? 'b' : 'a';
+                auto const expected =
+                    std::search(hay.begin(), hay.end(), pat.begin(), pat.end());
+                auto const res = ranges::search(hay, make(pat));
+                CHECK(res.begin() == expected);
+                if(expected != hay.end())
+                    CHECK((res.end() - res.begin()) == std::ptrdiff_t(pat.size()));
+                else
+                    CHECK(res.end() == hay.end());
+            }
+        }
+    }
+
+    // Projections apply to the pattern and to the haystack separately.
+    std::string const upper = "ABAABAABB";
+    auto res = ranges::search(
+        hay, make(upper, [](char c) { return char(c - 'A'); }), [](char c) {
+            return char(c - 'a');
+        });
+    CHECK(res.begin() == hay.begin());
+    CHECK(res.end() == hay.begin() + 9);
+
+    // Integral keys that share a low byte must not be confused.
+    std::vector<int> const ints = {1, 257, 513, 2, 1, 2, 257, 2, 1};
+    std::vector<int> const pat = {257, 2, 1};
+    CHECK(ranges::search(ints, make(pat)).begin() == ints.begin() + 6);
+}
+
 int main()
 {
     test<ForwardIterator<const int*>, ForwardIterator<const int*> >();
@@ -233,5 +277,31 @@ int main()
         CHECK(::is_dangling(ranges::search(std::move(ib), ie)));
     }
 
+    // Test searchers
+    test_searcher(ranges::make_boyer_moore_searcher);
+    test_searcher(ranges::make_boyer_moore_horspool_searcher);
+    test_searcher(ranges::make_two_way_searcher);
+    test_searcher([](auto && pat, auto... proj) {
+        // Long patterns are searched for with a searcher by default
+        return [&pat, proj...](auto first, auto last, auto... hproj) {
+            return ranges::search(first, last, pat.begin(), pat.end(),
+                                  ranges::equal_to{}, hproj..., proj...);
+        };
+    });
+    {
+        // Keys that are not integral are hashed.
+        std::vector<std::string> const words = {"a", "rose", "is", "a", "rose",
+                                                "is", "a", "rose"};
+        std::vector<std::string> const pat = {"rose", "is", "a", "rose"};
+        auto const bm = ranges::make_boyer_moore_searcher(pat);
+        CHECK(ranges::search(words, bm).begin() == words.begin() + 1);
+        auto const bmh = ranges::make_boyer_moore_horspool_searcher(pat);
+        CHECK(ranges::search(words, bmh).begin() == words.begin() + 1);
+        auto const tw = ranges::make_two_way_searcher(pat);
+        auto const res = ranges::search(words.begin(), words.end(), tw);
+        CHECK(res.begin() == words.begin() + 1);
+        CHECK(res.end() == words.begin() + 5);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,132 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::vector<int>> vv = {{1, 2}, {}, {3, 4, 5}, {}, {6}};
+    std::list<int> l = {7, 8, 9};
+
+    // join and concat visit their segments.
+    {
+        auto rng = vv | views::join;
+        CPP_assert(detail::segmented_range_v<decltype(rng)>);
+        CPP_assert(detail::segmented_range_v<decltype(views::concat(rng, l))>);
+        CPP_assert(!detail::segmented_range_v<std::vector<int>>);
+        CPP_assert(!detail::segmented_range_v<decltype(views::iota(0, 10))>);
+    }
+
+    // find stops in the middle of a segment, and returns an iterator into it.
+    {
+        auto rng = vv | views::join;
+        auto it = find(rng, 4);
+        CHECK(*it == 4);
+        CHECK(&*it == &vv[2][1]);
+        ::check_equal(make_subrange(it, end(rng)), {4, 5, 6});
+        CHECK(find(rng, 6) == next(begin(rng), 5));
+        CHECK(find(rng, 42) == end(rng));
+        CHECK(find(rng, 3, [](int i) { return i + 1; }) == next(begin(rng), 1));
+
+        auto cat = views::concat(rng, l);
+        auto it2 = find(cat, 8);
+        CHECK(*it2 == 8);
+        CHECK(&*it2 == &*next(l.begin()));
+        ::check_equal(make_subrange(it2, end(cat)), {8, 9});
+        CHECK(find(cat, 5) == next(begin(cat), 4));
+        CHECK(find(cat, 42) == end(cat));
+    }
+
+    // count, accumulate and for_each visit every segment.
+    {
+        auto rng = vv | views::join;
+        CHECK(count(rng, 5) == 1);
+        CHECK(count(rng, 1, [](int i) { return i % 2; }) == 3);
+        CHECK(accumulate(rng, 0) == 21);
+        CHECK(accumulate(views::concat(rng, l, rng), 0) == 66);
+
+        std::vector<int> seen;
+        auto cat = views::concat(l, rng);
+        auto res = for_each(cat, [&](int i) { seen.push_back(i); });
+        ::check_equal(seen, {7, 8, 9, 1, 2, 3, 4, 5, 6});
+        CHECK(res.in == end(cat));
+    }
+
+    // copy and fill write through the segments.
+    {
+        std::vector<int> out(6);
+        auto rng = vv | views::join;
+        auto res = copy(rng, out.begin());
+        CHECK(res.in == end(rng));
+        CHECK(res.out == out.end());
+        ::check_equal(out, {1, 2, 3, 4, 5, 6});
+
+        copy(views::concat(l, rng), back_inserter(out));
+        ::check_equal(out, {1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6});
+
+        auto vv2 = vv;
+        auto rng2 = vv2 | views::join;
+        CHECK(fill(rng2, 0) == end(rng2));
+        CHECK(vv2 == (std::vector<std::vector<int>>{{0, 0}, {}, {0, 0, 0}, {}, {0}}));
+    }
+
+    // Segments of segments are visited too.
+    {
+        std::vector<std::vector<std::vector<int>>> vvv = {vv, {}, {{10, 11}}};
+        auto rng = vvv | views::join | views::join;
+        CHECK(accumulate(rng, 0) == 42);
+        auto it = find(rng, 11);
+        CHECK(&*it == &vvv[2][0][1]);
+        CHECK(count(views::concat(rng, vv | views::join), 2) == 2);
+    }
+
+    // Inner ranges that are not references, and inner ranges without common
+    // iterator and sentinel types.
+    {
+        auto chunks = views::iota(0, 10) | views::chunk(3) | views::join;
+        CHECK(accumulate(chunks, 0) == 45);
+        CHECK(*find(chunks, 7) == 7);
+        CHECK(count(chunks, 9) == 1);
+
+        std::vector<std::string> words = {"ab", "", "cde"};
+        auto letters =
+            words | views::transform([](std::string const & s) {
+                return s | views::take_while([](char c) { return c != 'd'; });
+            }) |
+            views::join;
+        std::string s;
+        copy(letters, back_inserter(s));
+        CHECK(s == "abc");
+        CHECK(count(letters, 'e') == 0);
+        CHECK(find(letters, 'e') == end(letters));
+    }
+
+    return test_result();
+}
@@ -20,10 +20,13 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -261,6 +264,85 @@ int main()
         CHECK((res - ic) == sr);
         CHECK(ranges::lexicographical_compare(ic, res, ir, ir+sr, std::less<int>(), &U::k) == false);
     }
+
+    // Skewed inputs: the longer one is galloped over when it is random access.
+    {
+        std::vector<int> big;
+        for(int i = 0; i < 10000; ++i)
+            big.push_back(i / 3);
+        std::vector<int> small = {-5, 0, 17, 18, 18, 1000, 1000, 1000, 1000, 3332, 3333};
+        std::vector<int> expected, actual;
+        std::set_intersection(small.begin(), small.end(), big.begin(), big.end(),
+                              std::back_inserter(expected));
+        ::check_equal(expected, {0, 17, 18, 18, 1000, 1000, 1000, 3332, 3333});
+
+        ranges::set_intersection(small, big, ranges::back_inserter(actual));
+        CHECK(actual == expected);
+        actual.clear();
+        ranges::set_intersection(big, small, ranges::back_inserter(actual));
+        CHECK(actual == expected);
+        actual.clear();
+        ranges::set_intersection(ForwardIterator<const int*>(big.data()),
+                                 ForwardIterator<const int*>(big.data() + big.size()),
+                                 small.begin(), small.end(),
+                                 ranges::back_inserter(actual));
+        CHECK(actual == expected);
+        actual.clear();
+        ranges::set_intersection(
+            big, std::vector<int>{4000, 5000}, ranges::back_inserter(actual));
+        CHECK(actual.empty());
+    }
+
+    // Interleaved inputs take no more comparisons than a merge, at most
+    // 2 * (N1 + N2) - 1, and skewed ones far fewer. Inputs with runs of
+    // any length give the same elements as std::set_intersection.
+    {
+        int comparisons = 0;
+        auto const counted_less = [&comparisons](int a, int b) {
+            ++comparisons;
+            return a < b;
+        };
+        std::vector<int> even, odd, actual, expected;
+        for(int i = 0; i < 1000; ++i)
+        {
+            even.push_back(2 * i);
+            odd.push_back(2 * i + 1);
+        }
+        ranges::set_intersection(even, odd, ranges::back_inserter(actual), counted_less);
+        CHECK(comparisons <= 2 * 2000 - 1);
+        comparisons = 0;
+        ranges::set_intersection(odd, even, ranges::back_inserter(actual), counted_less);
+        CHECK(comparisons <= 2 * 2000 - 1);
+
+        std::vector<int> big, small = {17, 5000, 9000};
+        for(int i = 0; i < 10000; ++i)
+            big.push_back(i);
+        comparisons = 0;
+        ranges::set_intersection(small, big, ranges::back_inserter(actual), counted_less);
+        CHECK(comparisons < 200);
+
+        for(int run = 1; run != 40; ++run)
+        {
+            std::vector<int> a, b;
+            for(int i = 0; i != 3000; ++i)
+            {
+                if((i / run) % 3 != 1)
+                    a.push_back(i / 2);
+                if((i / (run + 1)) % 3 != 0)
+                    b.push_back(i / 2);
+            }
+            expected.clear();
+            actual.clear();
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            ranges::set_intersection(a, b, ranges::back_inserter(actual));
+            CHECK(actual == expected);
+            expected.clear();
+            actual.clear();
+            std::set_intersection(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(expected));
+            ranges::set_intersection(b, a, ranges::back_inserter(actual));
+            CHECK(actual == expected);
+        }
+    }
 #endif
 
     return ::test_result();
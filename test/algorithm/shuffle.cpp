@@ -31,6 +31,29 @@
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+namespace
+{
+    // Shuffle {0,1,2,3} many times and check that each element lands in each
+    // position about as often.
+    template<typename Gen>
+    void check_uniform(Gen g)
+    {
+        constexpr int M = 4, trials = 24000;
+        int counts[M][M] = {};
+        for(int t = 0; t < trials; ++t)
+        {
+            std::array<int, M> a;
+            ranges::iota(a, 0);
+            ranges::shuffle(a, g);
+            for(int i = 0; i < M; ++i)
+                ++counts[a[i]][i];
+        }
+        for(auto & row : counts)
+            for(int c : row)
+                CHECK((c > trials / M * 9 / 10 && c < trials / M * 11 / 10));
+    }
+}
+
 int main()
 {
     constexpr unsigned N = 100;
@@ -91,5 +114,10 @@ int main()
         CHECK(!ranges::equal(a, b));
     }
 
+    // Engines yielding 32 and 64 random bits, and one that yields fewer.
+    check_uniform(std::mt19937{});
+    check_uniform(std::mt19937_64{});
+    check_uniform(std::minstd_rand{});
+
     return ::test_result();
 }
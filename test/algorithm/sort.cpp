@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <functional>
 #include <memory>
 #include <random>
 #include <vector>
@@ -180,6 +181,64 @@ namespace
         test_larger_sorts(N, N);
     }
 
+    // Sorts v with each kind of comparison sort dispatches on and checks the
+    // result against std::sort.
+    void
+    test_pattern(std::vector<int> const & v)
+    {
+        auto w = v;
+        std::sort(w.begin(), w.end());
+        auto v2 = v;
+        CHECK(ranges::sort(v2) == v2.end());
+        CHECK(v2 == w);
+        v2 = v;
+        ranges::sort(v2, [](int a, int b) { return a < b; });
+        CHECK(v2 == w);
+        v2 = v;
+        ranges::sort(v2, std::greater<int>{}, [](int i) { return -i; });
+        CHECK(v2 == w);
+        v2 = v;
+        ranges::sort(v2, std::greater<>{});
+        CHECK(std::is_sorted(v2.rbegin(), v2.rend()));
+    }
+
+    void
+    test_patterns(int N)
+    {
+        std::vector<int> v(static_cast<std::size_t>(N));
+        // organ pipe
+        for(int i = 0; i < N; ++i)
+            v[(std::size_t)i] = i < N / 2 ? i : N - i;
+        test_pattern(v);
+        // sawtooth
+        for(int i = 0; i < N; ++i)
+            v[(std::size_t)i] = i % 97;
+        test_pattern(v);
+        // many duplicates
+        std::uniform_int_distribution<int> dist(0, 3);
+        for(auto & i : v)
+            i = dist(gen);
+        test_pattern(v);
+        // sorted with a few elements out of place
+        for(int i = 0; i < N; ++i)
+            v[(std::size_t)i] = i;
+        for(int i = 0; i < 8; ++i)
+            std::swap(v[(std::size_t)(i * 7919 % N)], v[(std::size_t)(i * 104729 % N)]);
+        test_pattern(v);
+        // median-of-3 killer
+        for(int i = 0; i < N / 2; ++i)
+        {
+            v[(std::size_t)(2 * i)] = i % 2 == 0 ? i : N / 2 + i - 1;
+            v[(std::size_t)(2 * i + 1)] = i % 2 == 0 ? N / 2 + i : i;
+        }
+        test_pattern(v);
+        // random
+        std::uniform_int_distribution<int> wide(0, N);
+        for(auto & i : v)
+            i = wide(gen);
+        test_pattern(v);
+    }
+
     struct S
     {
         int i, j;
@@ -254,6 +313,11 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    // Inputs that quicksort variants find hard
+    test_patterns(129);
+    test_patterns(1000);
+    test_patterns(100000);
+
     // Check move-only types
     {
         std::vector<std::unique_ptr<int> > v(1000);
@@ -334,5 +398,51 @@ int main()
         sort(rng);
     }
 
+    // Check execution policies
+    {
+        std::vector<int> v(200000);
+        std::uniform_int_distribution<int> dist(0, 1000);
+        for(auto & i : v)
+            i = dist(gen);
+        auto w = v;
+        std::sort(w.begin(), w.end());
+        auto v2 = v;
+        CHECK(ranges::sort(ranges::execution::par, v2) == v2.end());
+        CHECK(v2 == w);
+        v2 = v;
+        CHECK(ranges::sort(ranges::execution::par_unseq, v2.begin(), v2.end()) ==
+              v2.end());
+        CHECK(v2 == w);
+        v2 = v;
+        CHECK(ranges::sort(ranges::execution::seq, v2) == v2.end());
+        CHECK(v2 == w);
+        v2 = v;
+        ranges::sort(ranges::execution::par, v2, std::greater<int>{});
+        CHECK(std::is_sorted(v2.begin(), v2.end(), std::greater<int>{}));
+        CHECK(::is_dangling(ranges::sort(ranges::execution::par, std::move(v2))));
+    }
+    {
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (int)v.size() - i - 1;
+            v[i].j = i;
+        }
+        ranges::sort(ranges::execution::par, v, std::less<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i].i == i);
+            CHECK((std::size_t)v[i].j == v.size() - i - 1);
+        }
+    }
+    {
+        std::vector<std::unique_ptr<int> > v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i].reset(new int((int)v.size() - i - 1));
+        ranges::sort(ranges::execution::par, v, indirect_less());
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(*v[i] == i);
+    }
+
     return ::test_result();
 }
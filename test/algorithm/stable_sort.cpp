@@ -256,5 +256,42 @@ int main()
     }
 #endif // Avoid #890
 
+    // Check execution policies; the keys have many duplicates so that the
+    // result also checks stability.
+    {
+        std::vector<S> v(200000, S{});
+        std::uniform_int_distribution<int> dist(0, 100);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = dist(gen);
+            v[i].j = i;
+        }
+        auto by_i = [](S const & a, S const & b) { return a.i < b.i; };
+        auto w = v;
+        std::stable_sort(w.begin(), w.end(), by_i);
+        auto same = [](S const & a, S const & b) { return a.i == b.i && a.j == b.j; };
+
+        auto v2 = v;
+        CHECK(ranges::stable_sort(ranges::execution::par, v2, std::less<int>{}, &S::i) ==
+              v2.end());
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+        v2 = v;
+        ranges::stable_sort(ranges::execution::par_unseq, v2.begin(), v2.end(), by_i);
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+        v2 = v;
+        ranges::stable_sort(ranges::execution::seq, v2, by_i);
+        CHECK(std::equal(v2.begin(), v2.end(), w.begin(), same));
+    }
+    {
+        std::vector<std::unique_ptr<int> > v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i].reset(new int((int)v.size() - i - 1));
+        ranges::stable_sort(ranges::execution::par, v,
+                            [](std::unique_ptr<int> const & a,
+                               std::unique_ptr<int> const & b) { return *a < *b; });
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(*v[i] == i);
+    }
+
     return ::test_result();
 }
@@ -19,8 +19,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/transform.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/view/unbounded.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
@@ -426,5 +429,30 @@ int main()
     static_assert(std::is_same<ranges::binary_transform_result<S const*, S const *, int*>,
         decltype(ranges::transform(s, s, p, binary, &S::i, &S::i))>::value, "");
 
+    // Check execution policies
+    {
+        auto const rng = ranges::views::iota(0, 100000) |
+                         ranges::views::transform([](int j) { return j * 2; });
+        std::vector<int> in(rng.begin(), rng.end()), out(in.size() + 1, -1);
+        auto r = ranges::transform(ranges::execution::par, rng, out.begin(), unary);
+        CHECK(r.in == ranges::end(rng));
+        CHECK(r.out == out.end() - 1);
+        CHECK(out[0] == 1);
+        CHECK(out[99999] == 199999);
+        CHECK(out[100000] == -1);
+
+        auto r2 = ranges::transform(ranges::execution::par_unseq, in,
+                                    ranges::views::iota(0, 50000), out.begin(), binary);
+        CHECK(r2.in1 == in.begin() + 50000);
+        CHECK(out[0] == 0);
+        CHECK(out[49999] == 3 * 49999);
+        CHECK(out[50000] == 100001);
+
+        auto r3 = ranges::transform(ranges::execution::seq, s, s + 4, out.begin(), unary,
+                                    &S::i);
+        CHECK(r3.in == s + 4);
+        CHECK(out[3] == 5);
+    }
+
     return ::test_result();
 }
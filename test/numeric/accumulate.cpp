@@ -19,8 +19,12 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -71,5 +75,28 @@ int main()
     test<BidirectionalIterator<const int*>, Sentinel<const int*> >();
     test<RandomAccessIterator<const int*>, Sentinel<const int*> >();
 
+    // Check execution policies
+    {
+        using namespace ranges;
+        auto rng = views::iota(0, 100000) | views::transform([](int i) { return i % 7; });
+        CHECK(accumulate(execution::par, rng, 0L) == accumulate(rng, 0L));
+        CHECK(accumulate(execution::par_unseq, rng, 5L) == accumulate(rng, 5L));
+        CHECK(accumulate(execution::seq, rng, 0L) == accumulate(rng, 0L));
+
+        int const ia[] = {1, 2, 3, 4, 5, 6};
+        CHECK(accumulate(execution::par, ia, ia, 10) == 10);
+        CHECK(accumulate(execution::par, ia, 10) == 31);
+
+        // Associative but not commutative: the order of the elements is kept.
+        std::vector<std::string> words;
+        for(int i = 0; i < 10000; ++i)
+            words.push_back(std::to_string(i % 10));
+        CHECK(accumulate(execution::par, words, std::string{"x"}) ==
+              accumulate(words, std::string{"x"}));
+
+        std::vector<S> v(10000, S{1});
+        CHECK(accumulate(execution::par, v, 0, plus{}, &S::i) == 10000);
+    }
+
     return ::test_result();
 }
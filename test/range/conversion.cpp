@@ -13,10 +13,13 @@
 #include <map>
 #include <vector>
 
+#include <range/v3/action/join.hpp>
 #include <range/v3/action/sort.hpp>
+#include <range/v3/action/split.hpp>
 #include <range/v3/core.hpp>
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/indices.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
@@ -94,6 +97,88 @@ public:
     }
 };
 
+// A stateful allocator, to check which allocator a container was given.
+template<typename T>
+struct tagged_allocator
+{
+    using value_type = T;
+
+    int tag = 0;
+
+    tagged_allocator() = default;
+    explicit tagged_allocator(int t)
+      : tag(t)
+    {}
+    template<typename U>
+    tagged_allocator(tagged_allocator<U> const & that)
+      : tag(that.tag)
+    {}
+    T * allocate(std::size_t n)
+    {
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T * p, std::size_t n)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    bool operator==(tagged_allocator<U> const & that) const
+    {
+        return tag == that.tag;
+    }
+    template<typename U>
+    bool operator!=(tagged_allocator<U> const & that) const
+    {
+        return tag != that.tag;
+    }
+};
+
+void test_allocator()
+{
+    using namespace ranges;
+    using vec_t = std::vector<int, tagged_allocator<int>>;
+    tagged_allocator<int> const alloc{42};
+
+    {
+        auto v = views::iota(0, 4) | to<vec_t>(alloc);
+        CPP_assert(same_as<decltype(v), vec_t>);
+        CHECK(v.get_allocator().tag == 42);
+        check_equal(v, {0, 1, 2, 3});
+
+        // Unsized ranges, and allocators of another value type.
+        auto odd = to<vec_t>(views::iota(0, 6) | views::filter([](int i) {
+                                 return i % 2 == 1;
+                             }),
+                             tagged_allocator<char>{7});
+        CHECK(odd.get_allocator().tag == 7);
+        check_equal(odd, {1, 3, 5});
+
+        // Closures with an allocator compose with actions.
+        auto s = views::iota(0, 4) | views::reverse | (to<vec_t>(alloc) | actions::sort);
+        CHECK(s.get_allocator().tag == 42);
+        check_equal(s, {0, 1, 2, 3});
+
+        auto l = views::iota(0, 3) | to<std::list<int, tagged_allocator<int>>>(alloc);
+        CHECK(l.get_allocator().tag == 42);
+        check_equal(l, {0, 1, 2});
+    }
+
+    // Splitting a container gives containers with its allocator, and joining
+    // containers gives one with the allocator of the first of them.
+    {
+        vec_t v{{1, 0, 2, 3, 0, 4}, alloc};
+        auto pieces = actions::split(v, 0);
+        CHECK(pieces.size() == 3u);
+        check_equal(pieces[1], {2, 3});
+        CHECK(pieces[1].get_allocator().tag == 42);
+
+        auto joined = actions::join(pieces);
+        CPP_assert(same_as<decltype(joined), vec_t>);
+        CHECK(joined.get_allocator().tag == 42);
+        check_equal(joined, {1, 2, 3, 4});
+    }
+}
+
 #if RANGES_CXX_DEDUCTION_GUIDES >= RANGES_CXX_DEDUCTION_GUIDES_17
 template<typename I>
 vector_like(I, I) -> vector_like<ranges::iter_value_t<I>>;
@@ -221,5 +306,7 @@ int main()
         check_equal(d, v);
     }
 
+    test_allocator();
+
     return ::test_result();
 }
@@ -0,0 +1,153 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <vector>
+#include <range/v3/action/push_back.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    struct with_hint
+    {
+        std::vector<int> v;
+        ForwardIterator<int const *> begin() const
+        {
+            return ForwardIterator<int const *>{v.data()};
+        }
+        Sentinel<int const *> end() const
+        {
+            return Sentinel<int const *>{v.data() + v.size()};
+        }
+        ranges::size_hint_t size_hint() const
+        {
+            return {1, v.size()};
+        }
+    };
+
+    int allocations = 0;
+
+    template<typename T>
+    struct counting_allocator : std::allocator<T>
+    {
+        template<typename U>
+        struct rebind
+        {
+            using other = counting_allocator<U>;
+        };
+        counting_allocator() = default;
+        template<typename U>
+        counting_allocator(counting_allocator<U> const &) noexcept
+        {}
+        T * allocate(std::size_t n)
+        {
+            ++allocations;
+            return std::allocator<T>::allocate(n);
+        }
+    };
+} // namespace
+
+int main()
+{
+    using namespace ranges;
+    auto const odd = [](int i) { return i % 2 != 0; };
+    auto const unbounded = size_hint_t::unbounded();
+
+    std::vector<int> v = views::iota(0, 100) | to<std::vector>();
+
+    // Sized ranges know their size exactly; unsized ones know nothing.
+    CHECK(size_hint(v) == size_hint_t{100, 100});
+    CHECK(size_hint(views::iota(0)) == size_hint_t{0, unbounded});
+    CHECK(!size_hint(views::iota(0)).bounded());
+    CHECK(size_hint(with_hint{{1, 2, 3}}) == size_hint_t{1, 3});
+
+    // filter keeps at most the elements of its base.
+    auto evens = v | views::remove_if(odd);
+    CPP_assert(!sized_range<decltype(evens)>);
+    CHECK(size_hint(evens) == size_hint_t{0, 100});
+    CHECK(size_hint(evens | views::transform([](int i) { return i * 2; })) ==
+          size_hint_t{0, 100});
+    CHECK(size_hint(evens | views::take(10)) == size_hint_t{0, 10});
+    CHECK(size_hint(views::iota(0) | views::filter(odd)) == size_hint_t{0, unbounded});
+
+    // join adds up the hints of the inner ranges.
+    {
+        std::vector<std::vector<int>> vv = {{1, 2}, {}, {3, 4, 5}, {6}};
+        CHECK(size_hint(vv | views::join) == size_hint_t{6, 6});
+        auto filtered = vv | views::transform([=](std::vector<int> const & w) {
+                            return w | views::filter(odd);
+                        });
+        CHECK(!size_hint(filtered | views::join).bounded());
+    }
+
+    // concat adds up the hints of its ranges.
+    CHECK(size_hint(views::concat(evens, v)) == size_hint_t{100, 200});
+    CHECK(size_hint(views::concat(evens, views::iota(0))) ==
+          size_hint_t{0, unbounded});
+
+    // ranges::to allocates once, for the upper bound when it is tight, and
+    // for the lower bound when it is not.
+    {
+        auto w = views::concat(v, evens) | to<std::vector>();
+        CHECK(w.size() == 150u);
+        CHECK(w.capacity() == 200u);
+        auto l = evens | to<std::list>();
+        CHECK(l.size() == 50u);
+
+        auto const is5 = [](int i) { return i == 5; };
+        auto few = views::iota(0, 1 << 20) | views::filter(is5) | to<std::vector>();
+        CHECK(few.size() == 1u);
+        CHECK(few.capacity() < 16u);
+
+        // A multi-pass range with a loose hint is counted, not pushed back.
+        using counted_vector = std::vector<int, counting_allocator<int>>;
+        std::vector<int> big = views::iota(0, 100000) | to<std::vector>();
+        allocations = 0;
+        auto odds = big | views::filter(odd) | to<counted_vector>();
+        CHECK(odds.size() == 50000u);
+        CHECK(allocations == 1);
+    }
+
+    // push_back grows the container once.
+    {
+        std::vector<int> w = {1, 2};
+        w.shrink_to_fit();
+        push_back(w, views::concat(evens, v));
+        CHECK(w.size() == 152u);
+        CHECK(w.capacity() == 202u);
+        ::check_equal(w | views::take(4), {1, 2, 0, 2});
+
+        std::list<int> l;
+        push_back(l, evens);
+        CHECK(l.size() == 50u);
+
+        std::vector<int> big = views::iota(0, 100000) | to<std::vector>();
+        std::vector<int, counting_allocator<int>> odds;
+        allocations = 0;
+        push_back(odds, big | views::filter(odd));
+        CHECK(odds.size() == 50000u);
+        CHECK(allocations == 1);
+    }
+
+    return test_result();
+}
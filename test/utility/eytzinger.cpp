@@ -0,0 +1,103 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/eytzinger.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    CPP_assert(bidirectional_range<eytzinger_array<int>>);
+    CPP_assert(sized_range<eytzinger_array<int>>);
+    CPP_assert(same_as<range_reference_t<eytzinger_array<int>>, int const &>);
+
+    // Every size up to a few full levels, with duplicates.
+    for(int n = 0; n != 70; ++n)
+    {
+        std::vector<int> sorted;
+        for(int i = 0; i != n; ++i)
+            sorted.push_back(i / 2 * 3);
+        eytzinger_array<int> arr{sorted};
+        CHECK(arr.size() == sorted.size());
+        CHECK(equal(arr, sorted));
+        CHECK(equal(arr | views::reverse, sorted | views::reverse));
+        for(int v = -1; v <= n * 3 / 2 + 1; ++v)
+        {
+            auto lo = std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin();
+            auto hi = std::upper_bound(sorted.begin(), sorted.end(), v) - sorted.begin();
+            CHECK(distance(arr.begin(), arr.lower_bound(v)) == lo);
+            CHECK(distance(arr.begin(), arr.upper_bound(v)) == hi);
+            CHECK(distance(arr.equal_range(v)) == hi - lo);
+            CHECK(arr.contains(v) == (hi != lo));
+        }
+    }
+
+    // Searches by a comparison and a projection.
+    {
+        using P = std::pair<int, std::string>;
+        std::vector<P> sorted = {{9, "a"}, {7, "b"}, {7, "c"}, {4, "d"}, {1, "e"}};
+        eytzinger_array<P> arr{sorted};
+        CHECK(arr.lower_bound(7, std::greater<>{}, &P::first)->second == "b");
+        CHECK(arr.upper_bound(7, std::greater<>{}, &P::first)->second == "d");
+        CHECK(arr.lower_bound(0, std::greater<>{}, &P::first) == arr.end());
+        CHECK(!arr.contains(5, std::greater<>{}, &P::first));
+        ::check_equal(arr.equal_range(7, std::greater<>{}, &P::first) |
+                          views::transform(&P::second),
+                      {"b", "c"});
+    }
+
+    // From a range of another element type.
+    {
+        eytzinger_array<long> arr{views::iota(0, 1000)};
+        CHECK(*arr.lower_bound(500L) == 500L);
+        CHECK(*prev(arr.end()) == 999L);
+        CHECK(arr.data()[0] != 0L);
+    }
+
+    // From a range that is not sized, which is counted first.
+    {
+        auto evens = views::iota(0, 100) | views::filter([](int i) { return i % 2 == 0; });
+        CPP_assert(!sized_range<decltype(evens)>);
+        eytzinger_array<int> arr{evens};
+        CHECK(arr.size() == 50u);
+        ::check_equal(arr, evens);
+        CHECK(*arr.lower_bound(51) == 52);
+    }
+
+    // Of elements that cannot be default constructed.
+    {
+        struct boxed
+        {
+            int i;
+            explicit boxed(int j)
+              : i(j)
+            {}
+        };
+        eytzinger_array<boxed> arr{views::iota(0, 40)};
+        ::check_equal(arr | views::transform(&boxed::i), views::iota(0, 40));
+        CHECK(arr.lower_bound(17, less{}, &boxed::i)->i == 17);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,107 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+#include "../simple_test.hpp"
+
+namespace
+{
+    long fib(ranges::thread_pool & pool, int n)
+    {
+        if(n < 2)
+            return n;
+        long a = 0, b = 0;
+        pool.fork_join([&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+        return a + b;
+    }
+
+    void test_pool(ranges::thread_pool & pool)
+    {
+        CHECK(fib(pool, 20) == 6765L);
+        CHECK(pool.run([&] { return fib(pool, 18); }) == 2584L);
+
+        // Results that are references or move-only come back as they are.
+        int x = 0;
+        int & lref = pool.run([&]() -> int & { return x; });
+        CHECK(&lref == &x);
+        int && rref = pool.run([&]() -> int && { return std::move(x); });
+        CHECK(&rref == &x);
+        std::unique_ptr<int> p = pool.run([] { return std::unique_ptr<int>(new int(7)); });
+        CHECK((p && *p == 7));
+
+        // An exception thrown on either side is rethrown by fork_join.
+        bool caught = false;
+        try
+        {
+            pool.fork_join([] { throw std::runtime_error("f"); }, [] {});
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+        caught = false;
+        try
+        {
+            pool.fork_join([] {}, [] { throw std::runtime_error("g"); });
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+
+        // Parallel algorithms called from a task run on that task's pool.
+        std::vector<int> v(100000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>((i * 7919u) % 100003u);
+        pool.run([&] {
+            CHECK(&ranges::thread_pool::current() == &pool);
+            ranges::sort(ranges::execution::par, v);
+        });
+        CHECK(ranges::is_sorted(v));
+    }
+} // namespace
+
+int main()
+{
+    {
+        ranges::thread_pool pool{4};
+        CHECK(pool.size() == 4u);
+        test_pool(pool);
+
+        std::atomic<int> posted{0};
+        for(int i = 0; i < 1000; ++i)
+            pool.post([&] { ++posted; });
+        pool.run([] {});
+        while(posted.load() != 1000)
+            pool.run([] {});
+        CHECK(posted.load() == 1000);
+    }
+    {
+        // Without workers, the waiting threads do all the work.
+        ranges::thread_pool pool{0};
+        CHECK(pool.size() == 0u);
+        test_pool(pool);
+    }
+    CHECK(&ranges::thread_pool::current() == &ranges::thread_pool::default_pool());
+    CHECK(fib(ranges::thread_pool::default_pool(), 15) == 610L);
+
+    return ::test_result();
+}
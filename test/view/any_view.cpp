@@ -9,10 +9,14 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <list>
 #include <map>
+#include <string>
 #include <vector>
 
+#include <range/v3/algorithm/for_each.hpp>
 #include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/iota.hpp>
@@ -21,6 +25,8 @@
 #include <range/v3/view/tail.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_exactly.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
 
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -221,6 +227,111 @@ int main()
         SizedAnyView av3 = av1 | views::tail; // fail
     }
     
+    // Iterators store small cursors inline and large ones on the heap; copies
+    // and moves between the two must work.
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        using RA = any_view<int, category::random_access>;
+        RA small = v;
+        auto zipped = views::zip(v, v, v, v) |
+                      views::transform([](auto t) { return std::get<0>(t); });
+        RA large = zipped;
+        CPP_assert(detail::fits_any_cursor_buffer_v<
+                   detail::any_cursor_impl<std::vector<int>::iterator, int,
+                                           category::random_access>,
+                   std::vector<int>::iterator>);
+        CPP_assert(!detail::fits_any_cursor_buffer_v<
+                   detail::any_cursor_impl<iterator_t<decltype(zipped)>, int,
+                                           category::random_access>,
+                   iterator_t<decltype(zipped)>>);
+
+        auto i = small.begin();
+        auto j = large.begin();
+        auto i2 = i;
+        auto j2 = j;
+        ++i2;
+        ++j2;
+        CHECK(*i == 0);
+        CHECK(*i2 == 1);
+        CHECK(*j == 0);
+        CHECK(*j2 == 1);
+        i = j2; // inline <- heap
+        CHECK(*i == 1);
+        j = small.begin(); // heap <- inline
+        CHECK(*j == 0);
+        auto i3 = std::move(i);
+        CHECK(*i3 == 1);
+        i = std::move(j);
+        CHECK(*i == 0);
+        i += 4;
+        CHECK(*i == 4);
+        CHECK((i - small.begin()) == 4);
+        ::check_equal(small, ten_ints);
+        ::check_equal(large, ten_ints);
+    }
+
+    // for_each, accumulate and to walk a contiguous any_view through a
+    // pointer, and read other any_views an element at a time.
+    {
+        std::vector<int> v(200);
+        for(int i = 0; i < 200; ++i)
+            v[(std::size_t)i] = i;
+        std::list<int> l(v.begin(), v.end());
+
+        any_view<int &, category::forward> contiguous = v;
+        any_view<int &, category::forward> by_address = l;
+        any_view<int, category::forward | category::sized> by_value =
+            views::iota(0, 200);
+        any_view<std::string, category::forward> strings =
+            views::iota(0, 100) | views::transform([](int i) { return std::to_string(i); });
+        CPP_assert(detail::chunked_range_v<decltype(contiguous)>);
+        CPP_assert(detail::chunked_range_v<decltype(contiguous) &>);
+        CPP_assert(!detail::chunked_range_v<decltype(contiguous) const>);
+
+        CHECK(accumulate(contiguous, 0) == 19900);
+        CHECK(accumulate(by_address, 0) == 19900);
+        CHECK(accumulate(by_value, 0) == 19900);
+        CHECK(accumulate(strings, std::string{}).size() == 190u);
+
+        auto res = for_each(by_address, [](int & i) { ++i; });
+        CHECK(res.in == by_address.end());
+        CHECK(accumulate(l, 0) == 20100);
+        auto res2 = for_each(any_view<int &, category::forward>{v}, [](int & i) { ++i; });
+        CHECK(::is_dangling(res2.in));
+        CHECK(accumulate(v, 0) == 20100);
+
+        auto vec = by_value | to<std::vector>();
+        CHECK(vec.size() == 200u);
+        CHECK(vec.capacity() == 200u);
+        ::check_equal(vec, views::iota(0, 200));
+        ::check_equal(strings | to<std::vector>(),
+                      views::iota(0, 100) |
+                          views::transform([](int i) { return std::to_string(i); }));
+
+        any_view<int &, category::forward> empty;
+        CHECK(accumulate(empty, 42) == 42);
+        CHECK(for_each(empty, [](int &) { CHECK(false); }).in == empty.end());
+
+        std::vector<int> const cv(v);
+        any_view<int, category::forward> values = cv;
+        CHECK(accumulate(values, 0) == 20100);
+        ::check_equal(values | to<std::vector>(), cv);
+
+        int reads = 0;
+        any_view<int, category::forward> counted =
+            views::iota(0, 100) | views::transform([&reads](int i) {
+                ++reads;
+                return i;
+            });
+        for_each(counted, [&reads](int i) { CHECK(reads == i + 1); });
+        CHECK(reads == 100);
+        reads = 0;
+        CHECK(accumulate(counted, 0, [&reads](int sum, int i) {
+                  CHECK(reads == i + 1);
+                  return sum + i;
+              }) == 4950);
+    }
+
     test_polymorphic_downcast();
 
     return test_result();
@@ -0,0 +1,157 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <climits>
+#include <limits>
+#include <utility>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/buffered_istream.hpp>
+#include <range/v3/view/istream.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    template<typename Rng>
+    std::vector<std::string> strings(Rng && rng)
+    {
+        std::vector<std::string> v;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            v.emplace_back((*it).begin(), (*it).end());
+        return v;
+    }
+} // namespace
+
+int main()
+{
+    // Parsing, with blocks so small that numbers straddle them.
+    for(std::size_t block : {1u, 3u, 4096u})
+    {
+        std::istringstream ss{"  12 -7\n+3\t2147483647 -2147483648 0 -0  "};
+        auto rng = buffered_istream<int>(ss, block);
+        using Rng = decltype(rng);
+        CPP_assert(input_range<Rng> && view_<Rng>);
+        CPP_assert(!forward_range<Rng>);
+        ::check_equal(rng, {12, -7, 3, INT_MAX, INT_MIN, 0, 0});
+        CHECK(ss.eof());
+        CHECK(!ss.fail());
+    }
+    {
+        // Same as istream_view<T>, element for element.
+        std::string text;
+        for(int i = 0; i < 10000; ++i)
+            text += std::to_string(i * 7919 % 100003 - 50000) + (i % 7 ? " " : "\n");
+        std::istringstream a{text}, b{text};
+        auto expected = istream<long>(a) | to<std::vector>();
+        CHECK(expected.size() == 10000u);
+        ::check_equal(buffered_istream<long>(b, 100), expected);
+    }
+    {
+        // Malformed or out-of-range input ends the range and sets failbit.
+        std::istringstream ss{"1 2 x 3"};
+        ::check_equal(buffered_istream<int>(ss), {1, 2});
+        CHECK(ss.fail());
+        std::istringstream ss2{"1 2147483648"};
+        ::check_equal(buffered_istream<int>(ss2), {1});
+        CHECK(ss2.fail());
+        std::istringstream ss3{"1 -1"};
+        ::check_equal(buffered_istream<unsigned>(ss3), {1u});
+        CHECK(ss3.fail());
+        std::istringstream ss4{"65535 12abc"};
+        ::check_equal(buffered_istream<unsigned short>(ss4), {65535, 12});
+        CHECK(ss4.fail());
+    }
+    {
+        std::istringstream ss{"1.5 -2.25e2 +0.125 3"};
+        ::check_equal(buffered_istream<double>(ss, 2), {1.5, -225.0, 0.125, 3.0});
+        CHECK(!ss.fail());
+    }
+    {
+        // Only what std::from_chars accepts: no hexadecimal, no bare point.
+        std::istringstream ss{"-inf .5 2e 0x10"};
+        auto const v = buffered_istream<double>(ss) | to<std::vector>();
+        CHECK(v.size() == 3u);
+        CHECK(ss.fail());
+        if(v.size() == 3u)
+        {
+            CHECK(v[0] == -std::numeric_limits<double>::infinity());
+            CHECK(v[1] == 0.5);
+            CHECK(v[2] == 2.0);
+        }
+        std::istringstream ss2{"1 ."};
+        ::check_equal(buffered_istream<double>(ss2), {1.0});
+        CHECK(ss2.fail());
+    }
+    {
+        // The strtod fallback, whichever parser the view uses.
+        auto parse = [](std::string const & s) {
+            double d = -1.0;
+            auto const end =
+                detail::parse_float_strto_(s.data(), s.data() + s.size(), d);
+            return std::make_pair(end - s.data(), d);
+        };
+        CHECK(parse("0x1p3") == std::make_pair(std::ptrdiff_t{1}, 0.0));
+        CHECK(parse("1e+") == std::make_pair(std::ptrdiff_t{1}, 1.0));
+        CHECK(parse("+2.5e1x") == std::make_pair(std::ptrdiff_t{6}, 25.0));
+        CHECK(parse(".").first == 0);
+        CHECK(parse("+-1").first == 0);
+        CHECK(parse("1e999").first == 0);
+        CHECK(parse("NaN(x1)").first == 7);
+        CHECK(parse("nan(").first == 3);
+        CHECK(parse("Infinity").first == 8);
+    }
+    {
+        std::istringstream ss{""};
+        auto rng = buffered_istream<int>(ss);
+        CHECK(ranges::begin(rng) == ranges::end(rng));
+        CHECK(ss.eof());
+    }
+
+    // Lines
+    for(std::size_t block : {1u, 5u, 4096u})
+    {
+        std::istringstream ss{"Now is\nthe time\n\nfor all\ngood men"};
+        auto rng = buffered_getlines(ss, '\n', block);
+        CPP_assert(same_as<range_reference_t<decltype(rng)>, subrange<char const *>>);
+        ::check_equal(strings(rng), {"Now is", "the time", "", "for all", "good men"});
+        std::istringstream ss2{"a\nb\n"};
+        ::check_equal(strings(buffered_getlines(ss2, '\n', block)), {"a", "b"});
+        std::istringstream ss3{"a;b;c"};
+        ::check_equal(strings(buffered_getlines(ss3, ';', block)), {"a", "b", "c"});
+    }
+
+    // Chunks
+    {
+        std::string text(10000, 'x');
+        for(std::size_t i = 0; i < text.size(); i += 13)
+            text[i] = static_cast<char>('a' + i % 26);
+        std::istringstream ss{text};
+        auto rng = istream_chunks(ss, 4096);
+        std::vector<std::size_t> sizes;
+        std::string joined;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            sizes.push_back((*it).size());
+            joined.append((*it).begin(), (*it).end());
+        }
+        ::check_equal(sizes, {4096u, 4096u, 1808u});
+        CHECK(joined == text);
+    }
+
+    return ::test_result();
+}
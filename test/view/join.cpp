@@ -9,12 +9,15 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <array>
 #include <iterator>
 #include <forward_list>
 #include <functional>
 #include <vector>
 
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/generate_n.hpp>
@@ -24,6 +27,7 @@
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/filter.hpp>
 
@@ -90,6 +94,75 @@ RANGES_DIAGNOSTIC_IGNORE("-Wunused-member-function")
         auto v2 = u2 | ranges::views::chunk(3) | ranges::views::join(i2);
         CPP_assert(ranges::input_range<decltype(v2)>);
     }
+
+    // Inner ranges with a size known at compile time make the join random
+    // access and sized, and contiguous when they are arrays in a contiguous
+    // range.
+    void test_fixed_size_inner()
+    {
+        using namespace ranges;
+        std::vector<std::array<int, 3>> v = {{{5, 4, 3}}, {{2, 1, 0}}, {{11, 10, 9}}};
+        auto rng = v | views::join;
+        CPP_assert(random_access_range<decltype(rng)>);
+        CPP_assert(contiguous_range<decltype(rng)>);
+        CPP_assert(common_range<decltype(rng)>);
+        CPP_assert(sized_range<decltype(rng)>);
+        CHECK(rng.size() == 9u);
+        CHECK(ranges::data(rng) == v[0].data());
+        CHECK(rng[4] == 1);
+        auto it = ranges::begin(rng) + 5;
+        CHECK(*it == 0);
+        CHECK(*(it - 3) == 3);
+        CHECK((ranges::end(rng) - it) == 4);
+        CHECK((it += 4) == ranges::end(rng));
+        CHECK((it -= 9) == ranges::begin(rng));
+
+        sort(rng);
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5, 9, 10, 11});
+        ::check_equal(v[1], {3, 4, 5});
+
+        int out[9] = {};
+        copy(rng, out);
+        ::check_equal(out, {0, 1, 2, 3, 4, 5, 9, 10, 11});
+
+        int arr[2][2] = {{1, 2}, {3, 4}};
+        auto rng2 = arr | views::join;
+        CPP_assert(contiguous_range<decltype(rng2)>);
+        CHECK(size(rng2) == 4u);
+        CHECK(rng2[2] == 3);
+
+        // Arrays returned by reference from a random-access range that is not
+        // contiguous.
+        auto rng3 = views::iota(0, 3) |
+                    views::transform([&](int i) -> std::array<int, 3> & {
+                        return v[2 - static_cast<std::size_t>(i)];
+                    }) |
+                    views::join;
+        CPP_assert(random_access_range<decltype(rng3)>);
+        CPP_assert(!contiguous_range<decltype(rng3)>);
+        CHECK(size(rng3) == 9u);
+        CHECK(rng3[1] == 10);
+        ::check_equal(rng3 | views::take(4), {9, 10, 11, 3});
+
+        // Joining the chunks of a forward range gives back the range.
+        std::vector<int> flat = {0, 1, 2, 3, 4, 5, 6};
+        auto rng4 = flat | views::chunk(3) | views::join;
+        CPP_assert(same_as<decltype(rng4), ref_view<std::vector<int>>>);
+        CPP_assert(contiguous_range<decltype(rng4)>);
+        CHECK(size(rng4) == 7u);
+        CHECK(ranges::data(rng4) == flat.data());
+        auto rng5 = views::iota(0, 7) | views::chunk(2) | views::join;
+        CPP_assert(random_access_range<decltype(rng5)>);
+        CPP_assert(sized_range<decltype(rng5)>);
+        CHECK(rng5[6] == 6);
+        ::check_equal(rng5, {0, 1, 2, 3, 4, 5, 6});
+
+        // Inner ranges of different sizes are only bidirectional.
+        std::vector<std::vector<int>> vv = {{1}, {2, 3}};
+        CPP_assert(bidirectional_range<decltype(vv | views::join)>);
+        CPP_assert(!random_access_range<decltype(vv | views::join)>);
+        CPP_assert(!sized_range<decltype(vv | views::join)>);
+    }
 }
 
 int main()
@@ -271,6 +344,7 @@ int main()
 
     test_issue_283();
     test_issue_1414();
+    test_fixed_size_inner();
 
     return ::test_result();
 }
@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/lines.hpp>
+#include <range/v3/view/mapped_file.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    std::vector<std::string> to_strings(lines_view<ref_view<std::string>> rng)
+    {
+        return rng | views::transform([](subrange<char const *> line) {
+                   return std::string(line.begin(), line.end());
+               }) |
+               to<std::vector>();
+    }
+} // namespace
+
+int main()
+{
+    std::string text = "Now is\nthe time\n\nfor all\ngood men";
+    auto rng = text | views::lines;
+    ::check_equal(to_strings(rng), {"Now is", "the time", "", "for all", "good men"});
+
+    using Rng = decltype(rng);
+    CPP_assert(forward_range<Rng> && common_range<Rng> && view_<Rng>);
+    CPP_assert(same_as<range_reference_t<Rng>, subrange<char const *>>);
+    CHECK(ranges::begin(*ranges::begin(rng)) == text.data());
+
+    // A trailing delimiter does not start another line.
+    text = "a\nb\n";
+    ::check_equal(to_strings(views::lines(text)), {"a", "b"});
+    text = "\n";
+    ::check_equal(to_strings(views::lines(text)), {""});
+    text = "";
+    CHECK(ranges::empty(views::lines(text)));
+    text = "a;b;c";
+    ::check_equal(to_strings(text | views::lines(';')), {"a", "b", "c"});
+
+    // Lines of a memory-mapped file.
+    char const * const path = "range_v3_test_view_lines.txt";
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << "Now is\nthe time\nfor all\ngood men\n";
+    }
+    {
+        auto file = views::mapped_file(path);
+        CPP_assert(contiguous_range<mapped_file_view> && sized_range<mapped_file_view> &&
+                   view_<mapped_file_view>);
+        CHECK(file.size() == 33u);
+        CHECK(std::string(file.begin(), file.end()) ==
+              "Now is\nthe time\nfor all\ngood men\n");
+        std::vector<std::string> lines;
+        for(auto line : file | views::lines)
+            lines.emplace_back(line.begin(), line.end());
+        ::check_equal(lines, {"Now is", "the time", "for all", "good men"});
+    }
+    {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    }
+    CHECK(ranges::empty(views::mapped_file(path) | views::lines));
+    std::remove(path);
+
+    bool caught = false;
+    try
+    {
+        views::mapped_file(path);
+    }
+    catch(std::system_error const &)
+    {
+        caught = true;
+    }
+    CHECK(caught);
+
+    return ::test_result();
+}
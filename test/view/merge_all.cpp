@@ -0,0 +1,88 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/merge_all.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<std::vector<int>> runs = {{1, 4, 7}, {}, {2, 5, 8}, {0, 3, 6, 9}};
+        auto rng = views::merge_all(runs);
+        CPP_assert(input_range<decltype(rng)>);
+        CPP_assert(!forward_range<decltype(rng)>);
+        CPP_assert(!range<decltype(rng) const>);
+        CPP_assert(!sized_range<decltype(rng)>);
+        CHECK(ranges::size_hint(rng) == (size_hint_t{10, 10}));
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+        // Iterators share the position of the view, and a copy of the view
+        // starts over.
+        auto rng2 = views::merge_all(runs);
+        auto it = rng2.begin();
+        auto it2 = it;
+        ++it;
+        ++it;
+        CHECK(*it2 == 2);
+        CHECK(*rng2.begin() == 2);
+        auto rng3 = rng2;
+        ::check_equal(rng3, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK(ranges::distance(rng2) == 8);
+
+        ::check_equal(runs | views::merge_all, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        ::check_equal(runs | views::merge_all(std::greater<int>{}, [](int i) { return -i; }),
+                      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        runs.clear();
+        CHECK(ranges::distance(views::merge_all(runs)) == 0);
+    }
+
+    // Inner ranges that are views, made on the fly.
+    {
+        std::vector<int> expected;
+        for(int i = 0; i < 64; ++i)
+            for(int j = i * 3; j < i * 3 + 100; ++j)
+                expected.push_back(j);
+        std::sort(expected.begin(), expected.end());
+
+        auto rng = views::iota(0, 64) |
+                   views::transform([](int i) { return views::iota(i * 3, i * 3 + 100); });
+        CHECK(ranges::equal(views::merge_all(rng), expected));
+        ::check_equal(views::merge_all(rng) | views::take(5), {0, 1, 2, 3, 3});
+    }
+
+    // Equal elements come in the order of their runs.
+    {
+        using P = std::pair<int, int>;
+        std::list<std::vector<P>> runs = {
+            {{1, 0}, {3, 0}, {3, 1}}, {{1, 1}, {2, 0}, {3, 2}}, {{0, 0}, {3, 3}}};
+        auto merged = views::merge_all(runs, std::less<int>{}, &P::first) | to<std::vector>();
+        ::check_equal(merged,
+                      {P{0, 0}, P{1, 0}, P{1, 1}, P{2, 0}, P{3, 0}, P{3, 1}, P{3, 2},
+                       P{3, 3}});
+    }
+
+    return test_result();
+}
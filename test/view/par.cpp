@@ -0,0 +1,129 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+#include <range/v3/view/cache1.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/par.hpp>
+#include <range/v3/view/single.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    auto const square = [](int i) { return i * i; };
+    auto const odd = [](int i) { return i % 2 != 0; };
+
+    thread_pool pool{3};
+    std::vector<int> expected;
+    for(int i = 0; i < 10000; ++i)
+        if(odd(i * i))
+            expected.push_back(i * i);
+
+    // The pipeline after par runs per chunk; to keeps the order.
+    {
+        auto rng = views::iota(0, 10000) | views::par(pool, 128) |
+                   views::transform(square) | views::filter(odd);
+        CPP_assert(input_range<decltype(rng)>);
+        CPP_assert(!forward_range<decltype(rng)>);
+        CPP_assert(view_<decltype(rng)>);
+        CHECK((rng | to<std::vector>()) == expected);
+        CHECK(to<std::vector<int>>(rng) == expected);
+
+        // Iterating the view evaluates the chunks in order.
+        std::vector<int> seq;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            seq.push_back(*it);
+        CHECK(seq == expected);
+    }
+
+    // Without a pool, the current one is used. Chunk sizes need not divide
+    // the size of the range.
+    {
+        std::vector<int> v = views::iota(0, 1001) | to<std::vector>();
+        auto rng = v | views::par(7) | views::transform(square);
+        long long sum = 0;
+        for(int i : v)
+            sum += i * i;
+        CHECK(accumulate(rng, 0LL) == sum);
+        CHECK(accumulate(views::par(v, 1) | views::filter(odd), 0LL) == 250000LL);
+        CHECK(distance(views::par(v, 1)) == 1001);
+    }
+
+    // Elements that are references into the source are not copied.
+    {
+        std::vector<int> v(500, 1);
+        for_each(v | views::par(pool, 16) | views::filter(odd), [](int & i) { ++i; });
+        CHECK(distance(v | views::filter(odd)) == 0);
+
+        std::vector<std::string> words = {"a", "bb", "ccc"};
+        auto lengths = words | views::par(pool, 2) |
+                       views::transform([](std::string const & s) { return s.size(); }) |
+                       to<std::vector>();
+        ::check_equal(lengths, {1u, 2u, 3u});
+
+        // Prvalue pointers are buffered as they are.
+        auto ptrs = v | views::par(pool, 64) |
+                    views::transform([](int & i) { return &i; }) | to<std::vector>();
+        CHECK(ptrs.size() == v.size());
+        CHECK(ptrs.front() == &v.front());
+        CHECK(ptrs.back() == &v.back());
+    }
+
+    // References that do not outlive an increment, or the pipeline of their
+    // chunk, are buffered as copies.
+    {
+        auto const times10 = [](int i) { return i * 10; };
+        auto cached = views::iota(0, 8) | views::par(pool, 4) |
+                      views::transform(times10) | views::cache1;
+        ::check_equal(cached | to<std::vector>(), {0, 10, 20, 30, 40, 50, 60, 70});
+        ::check_equal(cached, {0, 10, 20, 30, 40, 50, 60, 70});
+
+        auto joined = views::iota(0, 8) | views::par(pool, 3) |
+                      views::transform([](int i) { return views::single(i); }) |
+                      views::join;
+        ::check_equal(joined | to<std::vector>(), {0, 1, 2, 3, 4, 5, 6, 7});
+
+    }
+
+    // Empty ranges, and exceptions from the pipeline.
+    {
+        std::vector<int> empty;
+        CHECK((empty | views::par(pool, 4) | to<std::vector>()).empty());
+
+        bool caught = false;
+        try
+        {
+            views::iota(0, 100) | views::par(pool, 10) | views::transform([](int i) {
+                if(i == 57)
+                    throw std::runtime_error("57");
+                return i;
+            }) | to<std::vector>();
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+    }
+
+    return test_result();
+}
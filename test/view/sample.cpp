@@ -1,10 +1,13 @@
 #include <range/v3/view/sample.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/range_for.hpp>
 #include <numeric>
 #include <vector>
 #include <random>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
+#include "../test_iterators.hpp"
 
 using namespace ranges;
 
@@ -38,5 +41,46 @@ int main ()
         CHECK(ranges::distance(rng) == 4);
     }
 
+    // An input range of unknown size is sampled into a reservoir.
+    {
+        auto rng = make_subrange(InputIterator<int*>(pop.data()),
+                                 Sentinel<int*>(pop.data() + pop.size())) |
+                   views::sample(10, engine);
+        using Rng = decltype(rng);
+        CPP_assert(input_range<Rng> && view_<Rng>);
+        CPP_assert(!forward_range<Rng>);
+        std::vector<int> tmp;
+        RANGES_FOR(int i, rng)
+            tmp.push_back(i);
+        CHECK(tmp.size() == 10u);
+        CHECK(is_sorted(tmp));
+
+        // The sample is kept for later calls to begin, but not copied.
+        CHECK(*rng.begin() == tmp.front());
+        auto const copy = rng;
+        CHECK(ranges::distance(Rng{copy}) == 10);
+        CHECK(*rng.begin() == tmp.front());
+        Rng empty{};
+        (void)empty;
+
+        std::array<int, 100> counts{};
+        constexpr int trials = 4000;
+        for(int t = 0; t < trials; ++t)
+        {
+            auto s = make_subrange(InputIterator<int*>(pop.data()),
+                                   Sentinel<int*>(pop.data() + pop.size())) |
+                     views::sample(10, engine);
+            RANGES_FOR(int i, s)
+                ++counts[static_cast<std::size_t>(i)];
+        }
+        for(int c : counts)
+            CHECK((c > trials / 10 * 3 / 4 && c < trials / 10 * 5 / 4));
+
+        auto all = make_subrange(InputIterator<int*>(pop.data()),
+                                 Sentinel<int*>(pop.data() + pop.size())) |
+                   views::sample(1000, engine);
+        CHECK(ranges::equal(all, pop));
+    }
+
     return ::test_result();
 }
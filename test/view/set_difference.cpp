@@ -265,5 +265,13 @@ int main()
         ::check_equal(rng, {1, 2, 3, 3, 3, 4, 4});
     }
 
+    // Skewed inputs: the longer one is galloped over when it is random access.
+    {
+        auto big = views::iota(0, 30000) | views::transform([](int i) { return i / 3; });
+        std::vector<int> small = {-5, 0, 17, 18, 18, 1000, 1000, 1000, 1000, 3332, 3333};
+        ::check_equal(views::set_difference(small, big), {-5, 1000});
+        CHECK(distance(views::set_difference(big, small)) == 30000 - 9);
+    }
+
     return test_result();
 }
@@ -224,5 +224,16 @@ int main()
         ::check_equal(rng, {2, 4, 4});
     }
 
+    // Skewed inputs: the longer one is galloped over when it is random access.
+    {
+        auto big = views::iota(0, 30000) | views::transform([](int i) { return i / 3; });
+        std::vector<int> small = {-5, 0, 17, 18, 18, 1000, 1000, 1000, 1000, 3332, 3333};
+        ::check_equal(views::set_intersection(small, big),
+                      {0, 17, 18, 18, 1000, 1000, 1000, 3332, 3333});
+        ::check_equal(views::set_intersection(big, small),
+                      {0, 17, 18, 18, 1000, 1000, 1000, 3332, 3333});
+        CHECK(distance(views::set_intersection(big, views::iota(20000, 20002))) == 0);
+    }
+
     return test_result();
 }
@@ -12,7 +12,9 @@
 #include <string>
 #include <cctype>
 #include <sstream>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/c_str.hpp>
 #include <range/v3/view/empty.hpp>
@@ -421,5 +423,13 @@ int main()
         CHECK(first != next(first));
     }
 
+    {
+        // Long patterns are found with a searcher
+        std::string const str = "one<--sep-->two<--sep--><--sep-->three<--sep-";
+        std::string const sep = "<--sep-->";
+        auto rng = str | views::split(sep) | to<std::vector<std::string>>();
+        ::check_equal(rng, {"one", "two", "", "three<--sep-"});
+    }
+
     return test_result();
 }
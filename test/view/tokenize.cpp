@@ -1,11 +1,112 @@
 #include <range/v3/core.hpp>
 #include <range/v3/view/tokenize.hpp>
 #include <range/v3/utility/copy.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <forward_list>
+#include <string>
+
+// Matches runs of decimal digits.
+struct digits_matcher
+{
+    template<typename I, typename S>
+    ranges::subrange<I> operator()(I first, S last) const
+    {
+        while(first != last && !('0' <= *first && *first <= '9'))
+            ++first;
+        I token = first;
+        while(first != last && '0' <= *first && *first <= '9')
+            ++first;
+        return {token, first};
+    }
+};
+
+void test_matchers()
+{
+    using namespace ranges;
+
+    // delimiter_set
+    {
+        std::string txt{",,abc, def;;ghi,"};
+        auto rng = txt | views::tokenize(delimiter_set{",; "});
+        const auto crng = views::tokenize(txt, delimiter_set{",; "});
+        ::check_equal(rng | views::transform([](subrange<std::string::iterator> s) {
+                          return std::string(s.begin(), s.end());
+                      }),
+                      {"abc", "def", "ghi"});
+        ::check_equal(crng | views::transform([](subrange<std::string::iterator> s) {
+                          return std::string(s.begin(), s.end());
+                      }),
+                      {"abc", "def", "ghi"});
+        ::has_type<subrange<std::string::iterator>>(*ranges::begin(rng));
+
+        CPP_assert(forward_range<decltype(rng)>);
+        CPP_assert(!bidirectional_range<decltype(rng)>);
+        CPP_assert(!sized_range<decltype(rng)>);
+        CPP_assert(view_<decltype(rng)>);
+        CPP_assert(forward_range<decltype(crng)>);
+        CPP_assert(!view_<decltype(crng)>);
+
+        // The tokens are subranges of the input, not copies.
+        auto it = ranges::begin(rng);
+        CHECK(&*(*it).begin() == &txt[2]);
+        ++it;
+        CHECK(&*(*it).begin() == &txt[7]);
+        CHECK((*it).size() == 3u);
+    }
+    {
+        char const * const txt = "  the quick\tbrown\n fox  ";
+        auto rng = views::tokenize(make_subrange(txt, txt + std::strlen(txt)),
+                                   delimiter_set{" \t\n"});
+        CHECK(distance(rng) == 4);
+        CHECK((*ranges::begin(rng)).begin() == txt + 2);
+        CHECK((*ranges::begin(rng)).end() == txt + 5);
+    }
+    {
+        std::string empty, delims{";;;"};
+        CHECK(distance(empty | views::tokenize(delimiter_set{";"})) == 0);
+        CHECK(distance(delims | views::tokenize(delimiter_set{";"})) == 0);
+        CHECK(distance(delims | views::tokenize(delimiter_set{})) == 1);
+
+        // Delimiters may be given as a range, and may be any byte.
+        std::string bytes{"a\xff" "b\x80" "c"};
+        std::string set{"\x80\xff"};
+        CHECK(distance(bytes | views::tokenize(delimiter_set{set})) == 3);
+        CHECK(delimiter_set{set}.contains('\x80'));
+        CHECK(!delimiter_set{set}.contains('a'));
+    }
+
+    // A user-defined matcher over a forward range
+    {
+        std::forward_list<char> txt{'a', '1', '2', 'b', 'c', '3', 'd'};
+        auto rng = txt | views::tokenize(digits_matcher{});
+        CHECK(distance(rng) == 2);
+        ::check_equal(*ranges::begin(rng), {'1', '2'});
+        ::check_equal(*next(ranges::begin(rng)), {'3'});
+    }
+
+    // A matcher may return empty tokens; the next search starts past them.
+    {
+        std::string txt{"a,,b"};
+        auto rng = txt | views::tokenize([](std::string::iterator first,
+                                            std::string::iterator last) {
+            return make_subrange(first, std::find(first, last, ','));
+        });
+        ::check_equal(rng | views::transform([](subrange<std::string::iterator> s) {
+                          return s.size();
+                      }),
+                      {1u, 0u, 0u, 1u});
+    }
+}
+
 int main()
 {
+    test_matchers();
+
     using namespace ranges;
 
     // GCC 4.8 doesn't do regex